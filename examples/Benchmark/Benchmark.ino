@@ -0,0 +1,358 @@
+#include "EasyRTSPServer.h"
+#include "MJPEGFileSource.h"
+#include <SD_MMC.h>
+#include "esp_timer.h"
+#include "bench_frame.h"
+
+//
+// Measures the hot paths of the library on the target itself, each one next to the
+// way it was done before so a single run shows both:
+//   - decodeJPEGfile() on OV2640 frames                       -> ns/frame
+//   - the 0xff scan of the entropy data, byte by byte and with findFF() of jpeg.cpp -> ns/frame
+//   - RTPFrame::packFrame() + buildHeader() for UDP and TCP, with the payload copied
+//     into one packet buffer and without                      -> ns/frame, bytes copied
+//   - UDP sends over loopback, one sendmsg() per packet and UDPSocket::sendBatch() -> ns/packet
+//   - RTSPParser over request traces of VLC, ffmpeg and live555 -> ns/request
+//
+// The frames come from an MJPEG recording on the SD card, e.g. captured with
+//   ffmpeg -i rtsp://<camera>/mjpeg/1 -c copy -f mjpeg -frames:v 100 bench.mjpeg
+// Without one the built in frame of bench_frame.h is used.
+//
+// No WiFi and no camera are needed. extras/host runs the same measurements on Linux.
+//
+
+#define BENCH_FILE "/bench.mjpeg"
+#define BENCH_MAX_FRAMES 16  // frames kept in memory, PSRAM recommended
+#define BENCH_ROUNDS 20      // passes over the frames / traces
+#define BENCH_UDP_PORT 50000 // loopback sink of the send benchmark
+
+// Request traces as the clients send them, one session each
+static const char VLC_TRACE[] =
+  "OPTIONS rtsp://192.168.1.102:554/mjpeg/1 RTSP/1.0\r\n"
+  "CSeq: 2\r\n"
+  "User-Agent: LibVLC/3.0.18 (LIVE555 Streaming Media v2016.11.28)\r\n"
+  "\r\n"
+  "DESCRIBE rtsp://192.168.1.102:554/mjpeg/1 RTSP/1.0\r\n"
+  "CSeq: 3\r\n"
+  "User-Agent: LibVLC/3.0.18 (LIVE555 Streaming Media v2016.11.28)\r\n"
+  "Accept: application/sdp\r\n"
+  "\r\n"
+  "SETUP rtsp://192.168.1.102:554/mjpeg/1/trackID=1 RTSP/1.0\r\n"
+  "CSeq: 4\r\n"
+  "User-Agent: LibVLC/3.0.18 (LIVE555 Streaming Media v2016.11.28)\r\n"
+  "Transport: RTP/AVP;unicast;client_port=57844-57845\r\n"
+  "\r\n"
+  "PLAY rtsp://192.168.1.102:554/mjpeg/1 RTSP/1.0\r\n"
+  "CSeq: 5\r\n"
+  "User-Agent: LibVLC/3.0.18 (LIVE555 Streaming Media v2016.11.28)\r\n"
+  "Session: 66334873\r\n"
+  "Range: npt=0.000-\r\n"
+  "\r\n"
+  "GET_PARAMETER rtsp://192.168.1.102:554/mjpeg/1 RTSP/1.0\r\n"
+  "CSeq: 6\r\n"
+  "User-Agent: LibVLC/3.0.18 (LIVE555 Streaming Media v2016.11.28)\r\n"
+  "Session: 66334873\r\n"
+  "\r\n";
+
+static const char FFMPEG_TRACE[] =
+  "OPTIONS rtsp://192.168.1.102:554/mjpeg/1 RTSP/1.0\r\n"
+  "CSeq: 1\r\n"
+  "User-Agent: Lavf60.3.100\r\n"
+  "\r\n"
+  "DESCRIBE rtsp://192.168.1.102:554/mjpeg/1 RTSP/1.0\r\n"
+  "Accept: application/sdp\r\n"
+  "CSeq: 2\r\n"
+  "User-Agent: Lavf60.3.100\r\n"
+  "\r\n"
+  "SETUP rtsp://192.168.1.102:554/mjpeg/1/trackID=1 RTSP/1.0\r\n"
+  "Transport: RTP/AVP/TCP;unicast;interleaved=0-1\r\n"
+  "CSeq: 3\r\n"
+  "User-Agent: Lavf60.3.100\r\n"
+  "\r\n"
+  "PLAY rtsp://192.168.1.102:554/mjpeg/1 RTSP/1.0\r\n"
+  "Range: npt=0.000-\r\n"
+  "CSeq: 4\r\n"
+  "User-Agent: Lavf60.3.100\r\n"
+  "Session: 66334873\r\n"
+  "\r\n"
+  // receiver report on the interleaved RTCP channel
+  "$\x01\x00\x20"
+  "\x81\xc9\x00\x07\x12\x34\x56\x78\x00\x00\x00\x01\x00\x00\x00\x00"
+  "\x00\x00\x00\x10\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00";
+
+static const char LIVE555_TRACE[] =
+  "OPTIONS rtsp://192.168.1.102:554/mjpeg/1 RTSP/1.0\r\n"
+  "CSeq: 1\r\n"
+  "User-Agent: openRTSP (LIVE555 Streaming Media v2023.01.19)\r\n"
+  "\r\n"
+  "DESCRIBE rtsp://192.168.1.102:554/mjpeg/1 RTSP/1.0\r\n"
+  "CSeq: 2\r\n"
+  "User-Agent: openRTSP (LIVE555 Streaming Media v2023.01.19)\r\n"
+  "Accept: application/sdp\r\n"
+  "\r\n"
+  "SETUP rtsp://192.168.1.102:554/mjpeg/1/trackID=1 RTSP/1.0\r\n"
+  "CSeq: 3\r\n"
+  "User-Agent: openRTSP (LIVE555 Streaming Media v2023.01.19)\r\n"
+  "Transport: RTP/AVP;unicast;client_port=60000-60001\r\n"
+  "\r\n"
+  "PLAY rtsp://192.168.1.102:554/mjpeg/1/ RTSP/1.0\r\n"
+  "CSeq: 4\r\n"
+  "User-Agent: openRTSP (LIVE555 Streaming Media v2023.01.19)\r\n"
+  "Session: 66334873\r\n"
+  "Range: npt=0.000-\r\n"
+  "\r\n"
+  "TEARDOWN rtsp://192.168.1.102:554/mjpeg/1/ RTSP/1.0\r\n"
+  "CSeq: 5\r\n"
+  "User-Agent: openRTSP (LIVE555 Streaming Media v2023.01.19)\r\n"
+  "Session: 66334873\r\n"
+  "\r\n";
+
+MJPEGFileSource source(SD_MMC, BENCH_FILE, 0, false, BENCH_MAX_FRAMES);  // every frame stays lent out
+CamFrame frames[BENCH_MAX_FRAMES];
+JpegInfo infos[BENCH_MAX_FRAMES];
+int frameCount = 0;
+uint32_t totalBytes = 0;
+bool fromCard = false;
+
+void benchJpeg() {
+  JpegInfo info;
+  int valid = 0;
+  int64_t start = esp_timer_get_time();
+  for (int r = 0; r < BENCH_ROUNDS; r++) {
+    for (int i = 0; i < frameCount; i++) {
+      valid += decodeJPEGfile(frames[i].buf, frames[i].len, &info);
+    }
+  }
+  int64_t usec = esp_timer_get_time() - start;
+  int n = BENCH_ROUNDS * frameCount;
+  Serial.printf("decodeJPEGfile:  %8u ns/frame  %5.1f MB/s  (%d/%d valid)\n",
+                (unsigned)(usec * 1000 / n), (double)totalBytes * BENCH_ROUNDS / usec, valid, n);
+}
+
+// byte by byte, how the scan for markers worked before
+static uint32_t findFFBytes(BufPtr p, uint32_t i, uint32_t len) {
+  while (i < len && p[i] != 0xff) {
+    i++;
+  }
+  return i;
+}
+
+void benchFindFF(const char* name, uint32_t (*scanner)(BufPtr, uint32_t, uint32_t)) {
+  uint32_t found = 0;
+  uint32_t bytes = 0;
+  int64_t start = esp_timer_get_time();
+  for (int r = 0; r < BENCH_ROUNDS; r++) {
+    for (int i = 0; i < frameCount; i++) {
+      BufPtr scan = infos[i].scan;
+      uint32_t len = infos[i].scanLen;
+      for (uint32_t pos = scanner(scan, 0, len); pos < len; pos = scanner(scan, pos + 1, len)) {
+        found++;
+      }
+      bytes += len;
+    }
+  }
+  int64_t usec = esp_timer_get_time() - start;
+  int n = BENCH_ROUNDS * frameCount;
+  Serial.printf("findFF %-6s    %8u ns/frame  %5.1f MB/s  (%u 0xff/frame)\n",
+                name, (unsigned)(usec * 1000 / n), (double)bytes / usec, found / n);
+}
+
+// With copy every packet is assembled in one buffer, header and payload, the way the
+// sender worked before the payload went out straight from the frame.
+void benchPacketize(const char* name, int packetSize, bool copy) {
+  static RTPFrame rtp;
+  static char header[KRtpMaxHeaderSize];
+  static char packet[KRtpMaxHeaderSize + RTP_TCP_PACKET_SIZE];
+
+  uint32_t packets = 0;
+  uint32_t copied = 0;
+  uint16_t seq = 0;
+  int64_t start = esp_timer_get_time();
+  for (int r = 0; r < BENCH_ROUNDS; r++) {
+    for (int i = 0; i < frameCount; i++) {
+      if (!rtp.packFrame(infos[i])) {
+        continue;
+      }
+      for (uint32_t offset = 0; offset < rtp.getLength();) {
+        BufPtr payload;
+        int payloadLen;
+        int headerLen = rtp.buildHeader(&offset, packetSize, seq++, 0, 0x12345678, copy ? packet : header, &payload, &payloadLen);
+        copied += headerLen;
+        if (copy) {
+          memcpy(packet + headerLen, payload, payloadLen);
+          copied += payloadLen;
+        }
+        packets++;
+      }
+    }
+  }
+  int64_t usec = esp_timer_get_time() - start;
+  int n = BENCH_ROUNDS * frameCount;
+  Serial.printf("packetize %-3s %-4s %8u ns/frame  %5u ns/packet  %4u packets/frame  %5u bytes copied/frame\n",
+                name, copy ? "copy" : "", (unsigned)(usec * 1000 / n), (unsigned)(usec * 1000 / packets), packets / n, copied / n);
+}
+
+static int sendPackets(UDPSocket* socket, const RTPPacket* batch, int count, IPAddress ip, bool batched) {
+  if (batched) {
+    uint32_t bytes;
+    return socket->sendBatch(batch, count, ip, BENCH_UDP_PORT, &bytes);
+  }
+  int failed = 0;
+  for (int i = 0; i < count; i++) {
+    struct iovec iov[2] = {
+      { batch[i].header + KRtpPrefixSize, (size_t)(batch[i].headerLen - KRtpPrefixSize) },
+      { (void*)batch[i].payload, (size_t)batch[i].payloadLen }
+    };
+    if (socket->sendv(iov, 2, ip, BENCH_UDP_PORT) < 0) {
+      failed++;
+    }
+  }
+  return failed;
+}
+
+// UDP packets of RTP_MAX_BATCH at a time to a loopback sink, one sendmsg() per packet
+// against UDPSocket::sendBatch(). lwIP has no sendmmsg(), on the ESP32 the two differ in
+// the setup per packet only, on Linux the batch is one sendmmsg() or GSO send.
+void benchSend(bool batched) {
+  static RTPFrame rtp;
+  static char headers[RTP_MAX_BATCH][KRtpMaxHeaderSize];
+  static uint8_t sinkBuf[RTP_UDP_MTU];
+  RTPPacket batch[RTP_MAX_BATCH];
+  UDPSocket sink, socket;
+  if (!sink.begin(BENCH_UDP_PORT) || !socket.begin(BENCH_UDP_PORT + 2)) {
+    Serial.println("send: no loopback sockets");
+    return;
+  }
+  IPAddress local(127, 0, 0, 1);
+
+  uint32_t packets = 0;
+  uint32_t failed = 0;
+  uint16_t seq = 0;
+  int64_t start = esp_timer_get_time();
+  for (int r = 0; r < BENCH_ROUNDS; r++) {
+    for (int i = 0; i < frameCount; i++) {
+      if (!rtp.packFrame(infos[i])) {
+        continue;
+      }
+      int count = 0;
+      for (uint32_t offset = 0; offset < rtp.getLength();) {
+        RTPPacket* packet = &batch[count];
+        packet->header = headers[count];
+        packet->headerLen = rtp.buildHeader(&offset, RTP_UDP_MTU - 28, seq++, 0, 0x12345678, packet->header, &packet->payload, &packet->payloadLen);
+        if (++count == RTP_MAX_BATCH || offset >= rtp.getLength()) {
+          failed += sendPackets(&socket, batch, count, local, batched);
+          packets += count;
+          count = 0;
+        }
+      }
+      while (sink.recv(sinkBuf, sizeof(sinkBuf)) > 0) {
+        ;  // the same for both, a full sink would only drop
+      }
+    }
+  }
+  int64_t usec = esp_timer_get_time() - start;
+  int n = BENCH_ROUNDS * frameCount;
+  Serial.printf("send udp %-7s  %8u ns/frame  %5u ns/packet  (%u failed)\n",
+                batched ? "batched" : "single", (unsigned)(usec * 1000 / n), (unsigned)(usec * 1000 / packets), failed);
+  socket.stop();
+  sink.stop();
+}
+
+// feeds the trace in reads of chunk bytes, like the socket would hand it over
+void benchParser(const char* name, const char* trace, uint32_t len, uint32_t chunk) {
+  static RTSPParser parser;
+  uint32_t requests = 0;
+  uint32_t frames = 0;
+  int64_t start = esp_timer_get_time();
+  for (int r = 0; r < BENCH_ROUNDS * 10; r++) {
+    parser.reset();
+    uint32_t pos = 0;
+    while (pos < len) {
+      uint32_t space;
+      char* p = parser.writeBuffer(&space);
+      uint32_t n = min(min(chunk, space), len - pos);
+      memcpy(p, trace + pos, n);
+      parser.commit(n);
+      pos += n;
+
+      RTSPRequest request;
+      RTSPSlice payload;
+      uint8_t channel;
+      RecvResult res;
+      while ((res = parser.next(&request, &channel, &payload)) != RecvResult::RECV_CONTINUE) {
+        if (res == RecvResult::RECV_FULL_REQUEST) {
+          requests++;
+        } else if (res == RecvResult::RECV_INTERLEAVED) {
+          frames++;
+        } else {
+          Serial.printf("%s: bad request at %u\n", name, pos);
+          return;
+        }
+      }
+    }
+  }
+  int64_t usec = esp_timer_get_time() - start;
+  Serial.printf("parse %-8s %4u B reads  %6u ns/request  %u requests  %u rtcp frames\n",
+                name, chunk, (unsigned)(usec * 1000 / (requests + frames)), requests, frames);
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial) {
+    ;
+  }
+
+  if (SD_MMC.begin() && source.begin()) {
+    while (frameCount < BENCH_MAX_FRAMES && source.capture(&frames[frameCount])) {
+      totalBytes += frames[frameCount].len;
+      frameCount++;
+    }
+    fromCard = frameCount > 0;
+  }
+  if (!fromCard) {
+    Serial.println("no " BENCH_FILE " on the SD card, using the built in frame");
+    frames[0].buf = (uint8_t*)malloc(sizeof(BENCH_JPEG));  // in RAM like a camera frame, not in flash
+    if (frames[0].buf) {
+      memcpy(frames[0].buf, BENCH_JPEG, sizeof(BENCH_JPEG));
+      frames[0].len = sizeof(BENCH_JPEG);
+      totalBytes = frames[0].len;
+      frameCount = 1;
+    }
+  }
+  for (int i = 0; i < frameCount; i++) {
+    decodeJPEGfile(frames[i].buf, frames[i].len, &infos[i]);
+  }
+  Serial.printf("%d frames %dx%d, %u bytes on average\n", frameCount, infos[0].width, infos[0].height,
+                frameCount ? totalBytes / frameCount : 0);
+
+  if (frameCount > 0) {
+    benchJpeg();
+    benchFindFF("bytes", findFFBytes);
+    benchFindFF("lib", findFF);
+    benchPacketize("udp", RTP_UDP_MTU - 28, true);
+    benchPacketize("udp", RTP_UDP_MTU - 28, false);
+    benchPacketize("tcp", RTP_TCP_PACKET_SIZE, true);
+    benchPacketize("tcp", RTP_TCP_PACKET_SIZE, false);
+    benchSend(false);
+    benchSend(true);
+  }
+  const char* names[] = { "vlc", "ffmpeg", "live555" };
+  const char* traces[] = { VLC_TRACE, FFMPEG_TRACE, LIVE555_TRACE };
+  uint32_t lens[] = { sizeof(VLC_TRACE) - 1, sizeof(FFMPEG_TRACE) - 1, sizeof(LIVE555_TRACE) - 1 };
+  for (int i = 0; i < 3; i++) {
+    benchParser(names[i], traces[i], lens[i], 1460);  // a whole segment per read
+    benchParser(names[i], traces[i], lens[i], 64);
+  }
+
+  for (int i = 0; i < frameCount; i++) {
+    if (fromCard) {
+      source.release(&frames[i]);
+    } else {
+      free(frames[i].buf);
+    }
+  }
+}
+
+void loop() {
+  vTaskDelay(1000);
+}
@@ -0,0 +1,467 @@
+#ifndef BENCH_FRAME_H_
+#define BENCH_FRAME_H_
+
+#include <stdint.h>
+
+// 320x240 baseline JPEG with 4:2:2 sampling like the OV2640 sends, quality 40,
+// so the JPEG and packetizer benchmarks run without an SD card
+static const uint8_t BENCH_JPEG[] = {
+  0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+  0x00, 0x01, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x14, 0x0e, 0x0f, 0x12, 0x0f, 0x0d, 0x14,
+  0x12, 0x10, 0x12, 0x17, 0x15, 0x14, 0x18, 0x1e, 0x32, 0x21, 0x1e, 0x1c, 0x1c, 0x1e, 0x3d, 0x2c,
+  0x2e, 0x24, 0x32, 0x49, 0x40, 0x4c, 0x4b, 0x47, 0x40, 0x46, 0x45, 0x50, 0x5a, 0x73, 0x62, 0x50,
+  0x55, 0x6d, 0x56, 0x45, 0x46, 0x64, 0x88, 0x65, 0x6d, 0x77, 0x7b, 0x81, 0x82, 0x81, 0x4e, 0x60,
+  0x8d, 0x97, 0x8c, 0x7d, 0x96, 0x73, 0x7e, 0x81, 0x7c, 0xff, 0xdb, 0x00, 0x43, 0x01, 0x15, 0x17,
+  0x17, 0x1e, 0x1a, 0x1e, 0x3b, 0x21, 0x21, 0x3b, 0x7c, 0x53, 0x46, 0x53, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0xff, 0xc0,
+  0x00, 0x11, 0x08, 0x00, 0xf0, 0x01, 0x40, 0x03, 0x01, 0x21, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11,
+  0x01, 0xff, 0xc4, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+  0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x10, 0x00, 0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05,
+  0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7d, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21,
+  0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 0x23,
+  0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17,
+  0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a,
+  0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a,
+  0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
+  0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+  0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7,
+  0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5,
+  0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1,
+  0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xc4, 0x00, 0x1f, 0x01, 0x00, 0x03,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x11, 0x00,
+  0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x07, 0x05, 0x04, 0x04, 0x00, 0x01, 0x02, 0x77, 0x00,
+  0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13,
+  0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0, 0x15,
+  0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26, 0x27,
+  0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+  0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+  0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
+  0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+  0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4,
+  0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe2,
+  0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9,
+  0xfa, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xe5,
+  0x57, 0x81, 0x4d, 0x61, 0x9a, 0xf6, 0xab, 0x3e, 0x6a, 0x76, 0x33, 0x8e, 0xe0, 0x83, 0x15, 0x21,
+  0xe9, 0x4a, 0x8b, 0xe5, 0x85, 0x8b, 0xea, 0x46, 0x57, 0x9a, 0x95, 0x38, 0xac, 0x68, 0x2e, 0x59,
+  0xb6, 0x5f, 0x40, 0x6e, 0x69, 0xaa, 0xb8, 0x34, 0xab, 0x2e, 0x6a, 0x97, 0x2a, 0x2f, 0x42, 0x50,
+  0x78, 0xa6, 0x32, 0xe4, 0xd6, 0x98, 0x87, 0xcf, 0x04, 0x91, 0x51, 0x1c, 0x83, 0x14, 0xf3, 0xc8,
+  0xa7, 0x4d, 0xda, 0x9f, 0x29, 0x5d, 0x48, 0xf6, 0xf3, 0x52, 0xaf, 0x02, 0xb1, 0xc3, 0xfb, 0x92,
+  0x6d, 0x96, 0xc4, 0x61, 0x9a, 0x15, 0x70, 0x6a, 0x26, 0xaf, 0x57, 0x98, 0xb4, 0xf4, 0x24, 0xcf,
+  0x14, 0xc2, 0xb9, 0x35, 0xa6, 0x25, 0xf3, 0xa5, 0x62, 0xa3, 0xa0, 0xf4, 0xe2, 0x95, 0xb9, 0xaa,
+  0x52, 0xfd, 0xd7, 0x29, 0x5d, 0x46, 0x85, 0xe6, 0xa5, 0x07, 0x8a, 0xcb, 0x0d, 0xee, 0x5e, 0xe5,
+  0xbd, 0x46, 0x30, 0xcd, 0x39, 0x06, 0x2b, 0x3b, 0x7e, 0xf7, 0x98, 0xb4, 0xf4, 0x1e, 0x79, 0x15,
+  0x1e, 0xde, 0x6a, 0xb1, 0x3e, 0xfb, 0x56, 0x2a, 0x3a, 0x12, 0xaf, 0x02, 0x86, 0x19, 0xab, 0x94,
+  0xaf, 0x4b, 0x94, 0x6b, 0x71, 0xaa, 0xb8, 0x35, 0x2e, 0x78, 0xa8, 0xc3, 0xbe, 0x48, 0xb4, 0xcb,
+  0x7a, 0x8c, 0x65, 0xc9, 0xa7, 0x20, 0xc5, 0x65, 0x4d, 0x5a, 0xaf, 0x31, 0xa5, 0xf4, 0x1e, 0xdc,
+  0x8a, 0x8c, 0x2f, 0x34, 0xf1, 0x1e, 0xfc, 0x93, 0x45, 0x44, 0x99, 0x78, 0x14, 0xd6, 0x19, 0xad,
+  0x2a, 0xbe, 0x6a, 0x7c, 0xa3, 0x5b, 0x82, 0x0c, 0x54, 0x99, 0xe2, 0xa6, 0x83, 0xe4, 0x83, 0x45,
+  0xbd, 0xc8, 0xca, 0xf3, 0x52, 0x27, 0x15, 0x8d, 0x15, 0xcb, 0x52, 0xe5, 0xf4, 0x30, 0x49, 0xc1,
+  0xa7, 0xa0, 0xcd, 0x77, 0xd2, 0x7c, 0xd3, 0xe5, 0x3e, 0x43, 0xa0, 0xac, 0x31, 0x4d, 0x07, 0x9a,
+  0x55, 0x9f, 0x24, 0xec, 0x54, 0x76, 0x25, 0x0b, 0xc5, 0x31, 0xb8, 0xad, 0x2b, 0x2e, 0x48, 0x5c,
+  0xa8, 0x8e, 0x4e, 0x69, 0xe5, 0x70, 0x28, 0xa6, 0xb9, 0xa9, 0xf3, 0x15, 0x7d, 0x46, 0x67, 0x9a,
+  0x91, 0x57, 0x35, 0x95, 0x07, 0xcf, 0x2b, 0x16, 0xf4, 0x11, 0x86, 0x29, 0x17, 0x93, 0x53, 0x52,
+  0x5c, 0xb5, 0x39, 0x4b, 0x5b, 0x12, 0xed, 0xe2, 0x98, 0x78, 0x35, 0x78, 0x8f, 0x72, 0x29, 0xa2,
+  0xa3, 0xa8, 0xe4, 0x19, 0xa7, 0x32, 0xe2, 0x9c, 0x55, 0xe9, 0xf3, 0x15, 0x7d, 0x46, 0x83, 0xcd,
+  0x48, 0xab, 0x91, 0x59, 0x61, 0xdf, 0xb4, 0x6e, 0xe5, 0xbd, 0x04, 0x6e, 0x28, 0x5e, 0x6a, 0x1c,
+  0xbf, 0x79, 0xca, 0x5a, 0xd8, 0x93, 0x6f, 0x14, 0xc2, 0x79, 0xaa, 0xc4, 0x7e, 0xee, 0xd6, 0x2a,
+  0x3a, 0x8f, 0x51, 0x9a, 0x56, 0x18, 0xab, 0x6b, 0xf7, 0x7c, 0xc3, 0x4f, 0x51, 0xa0, 0xe4, 0xd4,
+  0xa1, 0x78, 0xac, 0xf0, 0xff, 0x00, 0xbc, 0x4e, 0xe5, 0xbd, 0x06, 0x37, 0x14, 0xe4, 0x19, 0xac,
+  0xe3, 0x2b, 0xd4, 0xe5, 0x2f, 0xa0, 0xf2, 0xb8, 0x14, 0xcc, 0xf3, 0x4f, 0x10, 0xfd, 0x9b, 0x49,
+  0x15, 0x1d, 0x49, 0x15, 0x72, 0x29, 0x18, 0x62, 0xae, 0x6b, 0x96, 0x9f, 0x31, 0x49, 0xea, 0x0b,
+  0xcd, 0x49, 0xb7, 0x8a, 0x9a, 0x0b, 0x9e, 0x2d, 0x96, 0xf4, 0x18, 0x4e, 0x0d, 0x3d, 0x06, 0x6b,
+  0x2a, 0x72, 0xe6, 0xa9, 0xca, 0x5f, 0x41, 0x58, 0x62, 0x9a, 0x0f, 0x34, 0x56, 0x7c, 0x93, 0xb1,
+  0x51, 0x24, 0x0b, 0xc5, 0x23, 0x71, 0x57, 0x59, 0x72, 0x43, 0x98, 0xa8, 0xbd, 0x4c, 0x22, 0xb9,
+  0x34, 0xf4, 0xe2, 0xba, 0xa9, 0x2e, 0x5a, 0x9c, 0xc7, 0xc8, 0x5f, 0x41, 0x5b, 0x9a, 0x68, 0x5e,
+  0x69, 0x56, 0x5c, 0xd3, 0xb9, 0x71, 0xd8, 0x94, 0x1e, 0x29, 0x8c, 0x33, 0x5a, 0x57, 0x7c, 0xf0,
+  0xb0, 0xe3, 0xb8, 0xe4, 0x18, 0xa7, 0x9e, 0x45, 0x14, 0x9f, 0x2d, 0x3e, 0x52, 0xfa, 0x8c, 0xdb,
+  0xcd, 0x48, 0xbc, 0x0a, 0xc6, 0x87, 0xb9, 0x26, 0xd9, 0x6c, 0x46, 0x19, 0xa4, 0x55, 0xc1, 0xa9,
+  0xa8, 0xb9, 0xaa, 0x73, 0x14, 0x9e, 0x84, 0xb9, 0xe2, 0x98, 0x57, 0x26, 0xb4, 0xc4, 0x3e, 0x78,
+  0xa4, 0x8a, 0x8e, 0x83, 0xd0, 0x62, 0x9c, 0xdc, 0x8a, 0x71, 0x95, 0xa9, 0x72, 0x95, 0xd4, 0x60,
+  0x5e, 0x6a, 0x55, 0xe0, 0x56, 0x58, 0x7f, 0x71, 0xbb, 0x96, 0xf5, 0x1a, 0xc3, 0x34, 0x20, 0xc5,
+  0x66, 0xd7, 0xef, 0x79, 0x8b, 0x4f, 0x42, 0x42, 0x78, 0xa6, 0x15, 0xe6, 0xaf, 0x13, 0xef, 0xda,
+  0xc5, 0x47, 0x41, 0xe9, 0xc5, 0x2b, 0x73, 0x56, 0xe5, 0xfb, 0xae, 0x52, 0x96, 0xe3, 0x55, 0x70,
+  0x6a, 0x50, 0x78, 0xac, 0xf0, 0xfe, 0xe2, 0x77, 0x2d, 0xea, 0x31, 0x97, 0x34, 0xe4, 0x18, 0xac,
+  0xa2, 0xad, 0x57, 0x98, 0xbb, 0xe8, 0x3c, 0xf2, 0x2a, 0x3d, 0xbc, 0xd5, 0x62, 0x3d, 0xf9, 0x26,
+  0x8a, 0x8e, 0x84, 0xab, 0xc0, 0xa4, 0x61, 0x9a, 0xba, 0x92, 0xbd, 0x3e, 0x52, 0x96, 0xe0, 0xab,
+  0x83, 0x52, 0x67, 0x8a, 0x9a, 0x0f, 0x92, 0x2d, 0x32, 0x9e, 0xa3, 0x0a, 0xe4, 0xd3, 0xd3, 0x8a,
+  0xca, 0x92, 0xe5, 0xa9, 0xcc, 0x69, 0x7d, 0x05, 0x6e, 0x69, 0xa1, 0x79, 0xa5, 0x5d, 0x73, 0xce,
+  0xe5, 0x47, 0x62, 0x50, 0x78, 0xa6, 0xb0, 0xcd, 0x69, 0x59, 0xf3, 0x42, 0xc5, 0x47, 0x73, 0x19,
+  0x57, 0x22, 0x9a, 0xdc, 0x57, 0x7d, 0x55, 0xcb, 0x4f, 0x98, 0xf8, 0xf4, 0xf5, 0x04, 0xe6, 0xa4,
+  0x2b, 0xc5, 0x2a, 0x2b, 0x9e, 0x17, 0x2f, 0xa8, 0xcc, 0xf3, 0x4f, 0x41, 0x9a, 0xc6, 0x8b, 0xe7,
+  0x9d, 0x8b, 0x15, 0x86, 0x29, 0xaa, 0x72, 0x69, 0x55, 0x7c, 0xb5, 0x39, 0x4a, 0x5b, 0x12, 0x85,
+  0xe2, 0x98, 0xdc, 0x1a, 0xd2, 0xbf, 0xb9, 0x14, 0xca, 0x88, 0xe4, 0x19, 0xa7, 0x95, 0xc0, 0xa2,
+  0x9a, 0xe6, 0xa7, 0xcc, 0x55, 0xf5, 0x23, 0xcf, 0x35, 0x2a, 0xae, 0x45, 0x65, 0x87, 0x7c, 0xf2,
+  0x69, 0x96, 0xf4, 0x11, 0x86, 0x28, 0x5e, 0x6a, 0x25, 0x2b, 0x54, 0xe5, 0x2d, 0x6c, 0x49, 0xb7,
+  0x8a, 0x61, 0x38, 0x35, 0x78, 0x8f, 0x71, 0x2b, 0x15, 0x1d, 0x47, 0xa0, 0xcd, 0x2b, 0x0c, 0x55,
+  0x25, 0xfb, 0xae, 0x62, 0x93, 0xd4, 0x68, 0x3c, 0xd4, 0xa1, 0x78, 0xac, 0xf0, 0xff, 0x00, 0xbc,
+  0xbd, 0xcb, 0x7a, 0x0c, 0x6e, 0x29, 0x53, 0x9a, 0xcf, 0x9b, 0xf7, 0xbc, 0xa5, 0xad, 0x89, 0x0a,
+  0xe0, 0x54, 0x79, 0xe6, 0xab, 0x10, 0xfd, 0x9b, 0x56, 0x2a, 0x3a, 0x92, 0xaa, 0xe6, 0x91, 0x86,
+  0x2a, 0xe4, 0xad, 0x4b, 0x98, 0xa4, 0xf5, 0x11, 0x79, 0x35, 0x2e, 0xde, 0x2a, 0x30, 0xfe, 0xfc,
+  0x5b, 0x65, 0x3d, 0x06, 0x1e, 0x0d, 0x39, 0x06, 0x6b, 0x28, 0x4a, 0xf5, 0x39, 0x4b, 0xe8, 0x39,
+  0x97, 0x02, 0x98, 0x0f, 0x34, 0xf1, 0x0f, 0x92, 0x49, 0x17, 0x1d, 0x49, 0x55, 0x72, 0x29, 0x1b,
+  0x8a, 0xba, 0xab, 0x96, 0x9f, 0x30, 0xd3, 0xd4, 0x13, 0x9a, 0x93, 0x6f, 0x14, 0xa8, 0xae, 0x78,
+  0x5c, 0xb1, 0x84, 0xf3, 0x4f, 0x41, 0x9a, 0xc6, 0x8b, 0xe6, 0x9d, 0x8b, 0xe8, 0x62, 0x83, 0x81,
+  0x4d, 0x61, 0x9a, 0xf5, 0x2a, 0xbe, 0x68, 0x72, 0x9f, 0x1e, 0xb7, 0x05, 0x18, 0xa9, 0x09, 0xe2,
+  0x95, 0x17, 0xc9, 0x0b, 0x15, 0xd4, 0x61, 0x5e, 0x6a, 0x45, 0xe2, 0xb1, 0xa2, 0xb9, 0x27, 0x72,
+  0xee, 0x0d, 0xcd, 0x35, 0x57, 0x06, 0x95, 0x55, 0xcd, 0x53, 0x98, 0xb4, 0xf4, 0x25, 0x07, 0x8a,
+  0x63, 0x2e, 0x4d, 0x69, 0x5d, 0xf3, 0xc5, 0x22, 0xa3, 0xa0, 0xe4, 0x18, 0xa7, 0x9e, 0x45, 0x10,
+  0x97, 0x2d, 0x3e, 0x52, 0xba, 0x8c, 0xdb, 0xcd, 0x48, 0xbc, 0x0a, 0xca, 0x87, 0xb9, 0x26, 0xd9,
+  0x6f, 0x51, 0x18, 0x66, 0x85, 0x5c, 0x1a, 0x89, 0x2b, 0xd4, 0xe6, 0x2d, 0x3d, 0x09, 0x33, 0xc5,
+  0x30, 0xae, 0x4d, 0x5e, 0x21, 0xfb, 0x44, 0xac, 0x38, 0xe8, 0x3d, 0x38, 0xa5, 0x6e, 0x6a, 0x94,
+  0xbf, 0x77, 0xca, 0x52, 0xdc, 0x68, 0x5e, 0x6a, 0x50, 0x78, 0xac, 0xf0, 0xff, 0x00, 0xbb, 0xbd,
+  0xcb, 0x7a, 0x8d, 0x61, 0x9a, 0x54, 0x18, 0xac, 0xed, 0xfb, 0xce, 0x62, 0xd3, 0xd0, 0x79, 0x39,
+  0x14, 0xcd, 0xbc, 0xd5, 0x62, 0x3f, 0x78, 0xd5, 0x8a, 0x8e, 0x84, 0x8b, 0xc5, 0x0c, 0x33, 0x57,
+  0x29, 0x5e, 0x9f, 0x29, 0x4b, 0x71, 0xaa, 0xb8, 0x35, 0x2e, 0x78, 0xa8, 0xa0, 0xf9, 0x13, 0x4c,
+  0xb7, 0xa8, 0xc2, 0xb9, 0x34, 0xe4, 0x18, 0xac, 0xa0, 0xad, 0x53, 0x98, 0xbb, 0xe8, 0x3d, 0xb9,
+  0xa6, 0x05, 0xe6, 0x8a, 0xeb, 0x9e, 0x49, 0x95, 0x1d, 0x09, 0x14, 0xe0, 0x52, 0x30, 0xcd, 0x69,
+  0x56, 0x5c, 0xd4, 0xf9, 0x4a, 0x5b, 0x82, 0x8c, 0x54, 0x99, 0xe2, 0x95, 0x17, 0xc9, 0x0b, 0x16,
+  0x30, 0xaf, 0x34, 0xf4, 0xe2, 0xb1, 0xa4, 0xb9, 0x27, 0x72, 0xef, 0xa1, 0x82, 0x78, 0x34, 0xf4,
+  0x19, 0xae, 0xea, 0x4f, 0x9a, 0xa5, 0x8f, 0x8f, 0xe8, 0x2b, 0x0c, 0x53, 0x41, 0xe6, 0x8a, 0xef,
+  0x96, 0x76, 0x2e, 0x3b, 0x12, 0x85, 0xe2, 0x98, 0xdc, 0x56, 0x95, 0xd7, 0x2c, 0x2e, 0x38, 0xee,
+  0x39, 0x39, 0xa7, 0x95, 0xc0, 0xa2, 0x92, 0xe6, 0xa7, 0xcc, 0x5d, 0xf5, 0x23, 0xcf, 0x35, 0x2a,
+  0xae, 0x45, 0x63, 0x41, 0xf3, 0xcd, 0xa6, 0x5b, 0x11, 0x86, 0x29, 0x17, 0x93, 0x53, 0x52, 0x56,
+  0xa9, 0xca, 0x52, 0xd8, 0x97, 0x6f, 0x14, 0xc3, 0xc1, 0xad, 0x31, 0x1e, 0xe4, 0x53, 0x45, 0x44,
+  0x72, 0x0c, 0xd3, 0x99, 0x70, 0x29, 0xc5, 0x5e, 0x97, 0x31, 0x57, 0xd4, 0x60, 0x3c, 0xd4, 0xca,
+  0xb9, 0x15, 0x96, 0x19, 0xf3, 0xb7, 0x72, 0xde, 0x83, 0x5b, 0x8a, 0x13, 0x9a, 0xcd, 0xcb, 0xf7,
+  0xbc, 0xa5, 0xad, 0x89, 0x0a, 0xf1, 0x51, 0x9e, 0xb5, 0x78, 0x9f, 0x72, 0xd6, 0x2a, 0x3a, 0x92,
+  0x20, 0xcd, 0x2b, 0x0c, 0x55, 0xb5, 0xfb, 0xae, 0x62, 0x93, 0xd4, 0x6a, 0xf2, 0x6a, 0x50, 0xbc,
+  0x56, 0x78, 0x6f, 0x7d, 0x3b, 0x96, 0xf4, 0x18, 0xdc, 0x1a, 0x72, 0x0c, 0xd6, 0x51, 0x95, 0xea,
+  0xf2, 0x97, 0xd0, 0x79, 0x5c, 0x0a, 0x8f, 0x3c, 0xd5, 0x62, 0x5f, 0x24, 0x92, 0x45, 0x47, 0x52,
+  0x55, 0x5c, 0x8a, 0x46, 0x18, 0xab, 0xa8, 0xad, 0x4f, 0x98, 0xa4, 0xf5, 0x11, 0x79, 0x35, 0x2e,
+  0xde, 0x2a, 0x70, 0xfe, 0xfc, 0x5b, 0x65, 0x31, 0x87, 0x83, 0x4f, 0x41, 0x9a, 0xc6, 0x93, 0xe6,
+  0xa9, 0xca, 0x69, 0xd0, 0x56, 0x18, 0xa6, 0x83, 0xcd, 0x15, 0xdf, 0x24, 0xd2, 0x2a, 0x3b, 0x12,
+  0x85, 0xe2, 0x98, 0xdc, 0x56, 0x95, 0x97, 0x2d, 0x3b, 0x95, 0x1d, 0xcc, 0x32, 0xb9, 0x34, 0xf5,
+  0xe2, 0xba, 0xa9, 0x2e, 0x59, 0xf3, 0x1f, 0x21, 0x7d, 0x05, 0x6e, 0x69, 0xa1, 0x79, 0xa5, 0x59,
+  0x73, 0xcf, 0x98, 0xa8, 0x92, 0x83, 0xc5, 0x35, 0x86, 0x6a, 0xeb, 0x3e, 0x78, 0x58, 0xa8, 0x8a,
+  0xa3, 0x14, 0xf2, 0x72, 0x28, 0xa7, 0x2e, 0x58, 0x72, 0x95, 0xd4, 0x66, 0xde, 0x6a, 0x45, 0xe2,
+  0xb2, 0xa2, 0xb9, 0x25, 0x72, 0xf7, 0x11, 0x86, 0x68, 0x55, 0xc1, 0xa9, 0xa8, 0xb9, 0xaa, 0x73,
+  0x16, 0x9e, 0x84, 0x99, 0xe2, 0x98, 0x57, 0x26, 0xae, 0xbb, 0xf6, 0x89, 0x22, 0xa3, 0xa0, 0xf4,
+  0x18, 0xa5, 0x3c, 0xd3, 0x8c, 0xad, 0x4f, 0x94, 0xae, 0xa3, 0x42, 0xf3, 0x52, 0x03, 0x81, 0x59,
+  0xd0, 0xfd, 0xdb, 0x65, 0xbd, 0x44, 0x61, 0x9a, 0x14, 0x62, 0xa1, 0xaf, 0xde, 0x73, 0x16, 0x9e,
+  0x84, 0x99, 0xe2, 0x98, 0x57, 0x9a, 0xac, 0x47, 0xef, 0x2d, 0x62, 0xa3, 0xa0, 0xf5, 0xe2, 0x95,
+  0xb9, 0xaa, 0x72, 0xfd, 0xdf, 0x29, 0x4b, 0x71, 0xa1, 0x70, 0x6a, 0x50, 0x78, 0xa8, 0xa0, 0xfd,
+  0x9a, 0x65, 0x3d, 0x46, 0x32, 0xe6, 0x9c, 0x83, 0x15, 0x94, 0x55, 0xaa, 0x73, 0x17, 0x7d, 0x07,
+  0x9e, 0x45, 0x33, 0x6f, 0x35, 0x55, 0xff, 0x00, 0x78, 0xd3, 0x2e, 0x3a, 0x12, 0x2f, 0x02, 0x91,
+  0x86, 0x6a, 0xe7, 0x2e, 0x6a, 0x7c, 0xa3, 0x5b, 0x82, 0xae, 0x2a, 0x4c, 0xf1, 0x51, 0x45, 0xf2,
+  0x46, 0xc5, 0xee, 0x30, 0xae, 0x4d, 0x3d, 0x78, 0xac, 0xe9, 0xae, 0x59, 0xf3, 0x17, 0x7d, 0x05,
+  0x6e, 0x69, 0xa1, 0x79, 0xa5, 0x59, 0x73, 0xce, 0xe5, 0x44, 0x94, 0x1c, 0x0a, 0x6b, 0x0c, 0xd6,
+  0x95, 0x5f, 0x3c, 0x39, 0x4a, 0x8e, 0xe6, 0x32, 0xae, 0x45, 0x35, 0xb8, 0xae, 0xfa, 0xcb, 0x96,
+  0x9d, 0xcf, 0x90, 0x8e, 0xe0, 0x9c, 0xd4, 0x85, 0x78, 0xa5, 0x41, 0x73, 0x53, 0xb9, 0x5d, 0x48,
+  0xc9, 0xe6, 0xa5, 0x41, 0x9a, 0xc6, 0x83, 0xe6, 0x9b, 0x45, 0xbd, 0x81, 0x86, 0x29, 0xab, 0xc9,
+  0xa5, 0x59, 0xf2, 0xd4, 0xb1, 0x71, 0xd8, 0x94, 0x2f, 0x14, 0xc6, 0xe0, 0xd6, 0x98, 0x8f, 0x72,
+  0x09, 0xa1, 0xc4, 0x72, 0x0c, 0xd3, 0xd9, 0x70, 0x28, 0xa6, 0xaf, 0x4b, 0x98, 0xbb, 0xea, 0x47,
+  0x9e, 0x6a, 0x55, 0x5c, 0x8a, 0xcb, 0x0c, 0xf9, 0xe4, 0xd3, 0x2d, 0x88, 0xc3, 0x14, 0x8b, 0xc9,
+  0xa8, 0x9c, 0xad, 0x57, 0x94, 0xb5, 0xb1, 0x2e, 0xde, 0x2a, 0x33, 0xc1, 0xab, 0xc4, 0xfb, 0x89,
+  0x58, 0x71, 0xd4, 0x91, 0x06, 0x69, 0x58, 0x62, 0xa9, 0x2f, 0xdd, 0x73, 0x15, 0x7d, 0x46, 0x0e,
+  0xb5, 0x30, 0x5e, 0x2b, 0x3c, 0x37, 0xbf, 0x7b, 0x96, 0xf4, 0x18, 0xdc, 0x52, 0xa7, 0x35, 0x97,
+  0x37, 0xef, 0x79, 0x4d, 0x16, 0xc4, 0x85, 0x78, 0xa8, 0xf3, 0xcd, 0x5e, 0x27, 0xdc, 0x6a, 0xc3,
+  0x89, 0x2a, 0x0c, 0x8a, 0x46, 0x18, 0xab, 0x92, 0xb5, 0x2e, 0x62, 0x93, 0xd4, 0x45, 0xe4, 0xd4,
+  0xbb, 0x78, 0xa8, 0xc3, 0x7b, 0xf1, 0x6d, 0x96, 0xc6, 0x37, 0x06, 0x9c, 0x83, 0x35, 0x8d, 0x37,
+  0x7a, 0xbc, 0xa5, 0xf4, 0x1e, 0xc3, 0x02, 0xa3, 0x07, 0x9a, 0x78, 0x87, 0xc9, 0x34, 0x91, 0x51,
+  0x26, 0x55, 0xc8, 0xa6, 0xb7, 0x15, 0xa5, 0x55, 0xcb, 0x4e, 0xe5, 0x45, 0xea, 0x09, 0xcd, 0x49,
+  0xb7, 0x8a, 0x54, 0x17, 0x34, 0x1b, 0x29, 0xee, 0x46, 0x7a, 0xd4, 0x88, 0x33, 0x58, 0xd1, 0x7c,
+  0xd5, 0x2c, 0x69, 0xd0, 0xc4, 0x07, 0x02, 0x91, 0x86, 0x6b, 0xd3, 0xab, 0x2e, 0x78, 0x72, 0x9f,
+  0x1c, 0x81, 0x46, 0x2a, 0x42, 0x78, 0xa5, 0x49, 0xf2, 0x43, 0x94, 0xb1, 0x9b, 0x79, 0xa7, 0xaf,
+  0x15, 0x95, 0x25, 0xc9, 0x3e, 0x62, 0xee, 0x2b, 0x73, 0x4d, 0x0b, 0x83, 0x4a, 0xa2, 0xe6, 0x9f,
+  0x31, 0x49, 0xe8, 0x4a, 0x0f, 0x14, 0xc2, 0xb9, 0xab, 0xac, 0xf9, 0xe3, 0x62, 0xa3, 0xa0, 0xe5,
+  0x18, 0xa7, 0x1e, 0x45, 0x10, 0x97, 0x2d, 0x3e, 0x52, 0xba, 0x8d, 0xdb, 0xcd, 0x48, 0xa7, 0x02,
+  0xb3, 0xa3, 0xfb, 0xb7, 0x72, 0xf7, 0x11, 0x86, 0x68, 0x55, 0xc5, 0x44, 0x95, 0xea, 0x73, 0x16,
+  0x9e, 0x84, 0x99, 0xe2, 0x98, 0x57, 0x26, 0xae, 0xbb, 0xf6, 0x89, 0x15, 0x1d, 0x07, 0xaf, 0x14,
+  0xad, 0xcd, 0x35, 0x2f, 0xdd, 0xf2, 0x94, 0xb7, 0x1a, 0x17, 0x9a, 0x90, 0x1e, 0x2a, 0x28, 0x7e,
+  0xee, 0xe5, 0xee, 0x23, 0x0c, 0xd2, 0xa8, 0xc5, 0x67, 0x6f, 0xde, 0x73, 0x16, 0x9e, 0x83, 0xc9,
+  0xc8, 0xa6, 0x6d, 0xe6, 0xaa, 0xbf, 0xef, 0x1a, 0x2a, 0x3a, 0x12, 0x2f, 0x14, 0x8c, 0x33, 0x55,
+  0x29, 0x5e, 0x9f, 0x29, 0x4b, 0x70, 0x55, 0xc1, 0xa9, 0x33, 0xc5, 0x45, 0x17, 0xec, 0xd5, 0x8b,
+  0xdc, 0x61, 0x5c, 0xd3, 0x94, 0x62, 0xb3, 0x82, 0xe5, 0xa9, 0xcc, 0x5d, 0xf4, 0x1c, 0x79, 0xa6,
+  0x85, 0xe6, 0x8a, 0xcb, 0xda, 0x4a, 0xe5, 0x47, 0x42, 0x45, 0x38, 0x14, 0x8c, 0x33, 0x57, 0x52,
+  0x5c, 0xd0, 0xe5, 0x29, 0x6e, 0x0a, 0x31, 0x52, 0x67, 0x8a, 0x54, 0x9f, 0x24, 0x6c, 0x56, 0xe3,
+  0x0a, 0xe4, 0xd3, 0xd7, 0x8a, 0xca, 0x92, 0xe4, 0x9f, 0x31, 0x66, 0x01, 0xeb, 0x52, 0x20, 0xcd,
+  0x77, 0x51, 0x7c, 0xd5, 0x2c, 0x7c, 0x87, 0x41, 0x58, 0x62, 0x98, 0x3a, 0xd2, 0xae, 0xf9, 0x6a,
+  0x24, 0x54, 0x76, 0x26, 0x0b, 0xc5, 0x31, 0xb8, 0xad, 0x6b, 0xae, 0x5a, 0x69, 0x95, 0x1d, 0xc5,
+  0x4e, 0x6a, 0x42, 0xbc, 0x51, 0x45, 0x73, 0x53, 0xb9, 0x5d, 0x48, 0xfb, 0xd4, 0xa8, 0x32, 0x2b,
+  0x1c, 0x3b, 0xe6, 0x9b, 0x4c, 0xb6, 0x23, 0x8c, 0x52, 0x2f, 0x26, 0xa2, 0xa3, 0xb5, 0x5b, 0x16,
+  0xb6, 0x25, 0xdb, 0xc5, 0x31, 0xb8, 0x35, 0xa6, 0x27, 0xdc, 0x8a, 0x68, 0xa8, 0x8e, 0x41, 0x9a,
+  0x7b, 0x0c, 0x0a, 0xa8, 0xab, 0xd2, 0xe6, 0x2a, 0xfa, 0x91, 0x8e, 0xb5, 0x32, 0xaf, 0x15, 0x96,
+  0x19, 0xf3, 0xb7, 0x72, 0xd8, 0xd6, 0xe2, 0x84, 0xe6, 0xb3, 0x6f, 0xf7, 0xbc, 0xa5, 0xad, 0x89,
+  0x0a, 0xf1, 0x51, 0x9e, 0xb5, 0x78, 0xaf, 0x72, 0xd6, 0x2a, 0x24, 0x88, 0x33, 0x4a, 0xc3, 0x15,
+  0x6d, 0x7e, 0xeb, 0x98, 0x69, 0xea, 0x35, 0x7a, 0xd4, 0xa1, 0x78, 0xac, 0xf0, 0xde, 0xfa, 0x77,
+  0x2d, 0x8c, 0x6e, 0x0d, 0x39, 0x06, 0x6b, 0x18, 0xbb, 0xd5, 0xe5, 0x34, 0xe8, 0x3d, 0x97, 0x02,
+  0xa3, 0xef, 0x55, 0x89, 0x7c, 0x92, 0x49, 0x15, 0x12, 0x55, 0x5c, 0x8a, 0x47, 0x18, 0xad, 0x2a,
+  0x2b, 0x52, 0xb8, 0xd3, 0xd4, 0x45, 0xe4, 0xd4, 0xbb, 0x78, 0xa9, 0xc3, 0xfb, 0xd0, 0x6d, 0x96,
+  0xc8, 0xcf, 0x5a, 0x91, 0x06, 0x6b, 0x1a, 0x4f, 0x9a, 0xa5, 0x8b, 0xe8, 0x2b, 0x0c, 0x53, 0x07,
+  0x5a, 0x31, 0x0f, 0x96, 0x69, 0x22, 0xe3, 0xb1, 0x30, 0x5e, 0x29, 0x8d, 0xc5, 0x69, 0x5d, 0x72,
+  0xd3, 0xb8, 0xe3, 0xb9, 0x86, 0x57, 0x26, 0x9e, 0xbc, 0x57, 0x55, 0x35, 0xc9, 0x3e, 0x63, 0xe4,
+  0x2e, 0x29, 0xe6, 0x9a, 0x17, 0x06, 0x95, 0x55, 0xcf, 0x2e, 0x62, 0xd6, 0x84, 0x80, 0xf1, 0x48,
+  0x57, 0x35, 0x75, 0x5f, 0x3c, 0x79, 0x4a, 0x5a, 0x0a, 0xa3, 0x14, 0xf2, 0x72, 0x29, 0x53, 0x97,
+  0x2c, 0x39, 0x4a, 0x19, 0xb7, 0x9a, 0x91, 0x78, 0xac, 0xe9, 0x2f, 0x67, 0x2b, 0x97, 0xb8, 0x8c,
+  0x33, 0x42, 0xae, 0x2a, 0x66, 0xb9, 0xa7, 0xcc, 0x52, 0x7a, 0x12, 0x67, 0x8a, 0x61, 0x5c, 0xd5,
+  0xd6, 0x7e, 0xd1, 0x58, 0xa8, 0xe8, 0x3d, 0x46, 0x29, 0x4f, 0x34, 0xe3, 0x2b, 0x43, 0x94, 0xbe,
+  0xa3, 0x42, 0xf3, 0x52, 0x03, 0x81, 0x59, 0xd1, 0xfd, 0xdb, 0x2b, 0x71, 0x18, 0x66, 0x85, 0x18,
+  0xa8, 0x71, 0xfd, 0xe7, 0x31, 0x69, 0xe8, 0x49, 0x9e, 0x29, 0x9b, 0x79, 0xaa, 0xaf, 0xfb, 0xc2,
+  0xa3, 0xa0, 0xf5, 0xe2, 0x94, 0xf3, 0x4d, 0xcb, 0xf7, 0x7c, 0xa5, 0x2d, 0xc6, 0x85, 0xc1, 0xa9,
+  0x01, 0xe2, 0xa2, 0x8b, 0xf6, 0x68, 0xbd, 0xc6, 0x95, 0xcd, 0x39, 0x46, 0x2a, 0x12, 0xb4, 0xf9,
+  0x8b, 0xbe, 0x83, 0x89, 0xcd, 0x37, 0x6f, 0x34, 0x56, 0xfd, 0xe3, 0xb9, 0x51, 0xd0, 0x91, 0x4e,
+  0x29, 0x18, 0x66, 0xae, 0x72, 0xe6, 0x87, 0x29, 0x4b, 0x70, 0x55, 0xc5, 0x49, 0x9e, 0x2a, 0x69,
+  0x3f, 0x67, 0x1b, 0x17, 0xb8, 0xc2, 0xb9, 0x34, 0xf5, 0xe2, 0xb3, 0x82, 0xe5, 0x9f, 0x31, 0x77,
+  0x14, 0xf3, 0x4d, 0x0b, 0xcd, 0x2a, 0xab, 0x9e, 0x5c, 0xc5, 0x27, 0x62, 0x40, 0x70, 0x29, 0x08,
+  0xcd, 0x5d, 0x59, 0x73, 0xc3, 0x94, 0xa4, 0x63, 0x2a, 0xf1, 0x4c, 0x7e, 0x2b, 0xd0, 0xae, 0xb9,
+  0x69, 0xdc, 0xf8, 0xf8, 0xee, 0x2a, 0x73, 0x52, 0x15, 0xe2, 0x95, 0x05, 0xcd, 0x4d, 0xb2, 0xde,
+  0xe4, 0x67, 0xad, 0x4a, 0x83, 0x35, 0x85, 0x07, 0xcd, 0x51, 0xa6, 0x5b, 0xd8, 0x1c, 0x62, 0x9a,
+  0xbd, 0x69, 0x56, 0x7c, 0xb5, 0x6c, 0x5c, 0x76, 0x25, 0x0b, 0xc5, 0x31, 0xb8, 0x35, 0xae, 0x27,
+  0xdd, 0x82, 0x68, 0x71, 0x1c, 0x83, 0x34, 0xf6, 0x18, 0x14, 0x53, 0x57, 0xa5, 0x72, 0xba, 0x91,
+  0xf7, 0xa9, 0x54, 0x64, 0x56, 0x38, 0x67, 0xcd, 0x26, 0x99, 0xa3, 0x11, 0xc6, 0x29, 0x13, 0x93,
+  0x51, 0x37, 0x6a, 0xb6, 0x29, 0x6c, 0x4b, 0xb7, 0x8a, 0x8c, 0xf5, 0xad, 0x31, 0x5e, 0xe2, 0x56,
+  0x2a, 0x24, 0x88, 0x33, 0x4a, 0xc3, 0x15, 0x49, 0x7e, 0xe6, 0xe5, 0x5f, 0x51, 0x83, 0xad, 0x4c,
+  0x17, 0x8a, 0xcb, 0x0b, 0xef, 0xde, 0xe5, 0xb1, 0x8d, 0xc5, 0x2a, 0x73, 0x59, 0xa7, 0xfb, 0xeb,
+  0x16, 0xb6, 0x24, 0x2b, 0xc5, 0x47, 0xde, 0xab, 0x15, 0xee, 0x35, 0x62, 0xa2, 0x4a, 0x83, 0x22,
+  0x91, 0xc6, 0x2b, 0x49, 0xab, 0x52, 0xb9, 0x49, 0xea, 0x22, 0xf2, 0x6a, 0x5d, 0xbc, 0x54, 0x61,
+  0xbd, 0xe8, 0xbb, 0x94, 0xc8, 0xdb, 0x83, 0x4f, 0x41, 0x9a, 0xc6, 0x9b, 0xbd, 0x5b, 0x1a, 0x74,
+  0x1e, 0xc3, 0x02, 0xa3, 0x1d, 0x69, 0xe2, 0x5f, 0x2c, 0xd2, 0x45, 0x44, 0x99, 0x57, 0x8a, 0x6b,
+  0xf1, 0x5a, 0x56, 0x56, 0xa5, 0x71, 0xc7, 0x70, 0x4e, 0x4d, 0x48, 0x57, 0x8a, 0x58, 0x7f, 0x7a,
+  0x9b, 0x6c, 0xb7, 0xb9, 0x19, 0xeb, 0x52, 0x20, 0xcd, 0x61, 0x41, 0xf3, 0x54, 0x68, 0xb7, 0xb1,
+  0x88, 0x0e, 0x05, 0x21, 0x19, 0xaf, 0x52, 0xa4, 0xb9, 0xe1, 0xca, 0x7c, 0x7a, 0x05, 0x18, 0xa7,
+  0xe7, 0x22, 0xa6, 0x9c, 0xb9, 0x23, 0xca, 0x56, 0xe3, 0x76, 0xf3, 0x4f, 0x5e, 0x2b, 0x3a, 0x6b,
+  0x92, 0x5c, 0xc5, 0xde, 0xe2, 0x9e, 0x69, 0x02, 0xe2, 0x95, 0x45, 0xcf, 0x3e, 0x62, 0xd3, 0x1e,
+  0x0f, 0x14, 0x85, 0x73, 0x57, 0x55, 0xfb, 0x48, 0xd8, 0xa5, 0xa0, 0xaa, 0x31, 0x4e, 0x27, 0x34,
+  0x46, 0x5c, 0xb0, 0xe5, 0x28, 0x6e, 0xde, 0x6a, 0x40, 0x71, 0x59, 0xd2, 0xfd, 0xdb, 0xb9, 0x7b,
+  0x88, 0x46, 0x68, 0x55, 0xc5, 0x4c, 0xa3, 0x79, 0xf3, 0x16, 0x9e, 0x83, 0xf3, 0xc5, 0x34, 0xae,
+  0x4d, 0x55, 0x67, 0xed, 0x11, 0x51, 0xd0, 0x7a, 0xf1, 0x4a, 0x79, 0xa7, 0xcd, 0xee, 0x72, 0x94,
+  0xb7, 0x1a, 0x17, 0x9a, 0x90, 0x1c, 0x0a, 0xce, 0x8f, 0xee, 0xcb, 0xdc, 0x42, 0x33, 0x4a, 0xa3,
+  0x15, 0x1c, 0xbe, 0xff, 0x00, 0x31, 0x49, 0xe8, 0x38, 0x9c, 0xd3, 0x76, 0xf3, 0x4e, 0xb7, 0xef,
+  0x19, 0x71, 0xd0, 0x7a, 0xf1, 0x41, 0xe6, 0xaa, 0x52, 0xbc, 0x39, 0x46, 0xb7, 0x00, 0xb8, 0xa7,
+  0xe7, 0x8a, 0x9a, 0x4f, 0xd9, 0xab, 0x17, 0xb8, 0xd2, 0xb9, 0xa7, 0x28, 0xc5, 0x67, 0x15, 0xcb,
+  0x3e, 0x62, 0xee, 0x38, 0xf3, 0x4d, 0x0b, 0xcd, 0x15, 0x57, 0xb4, 0x95, 0xca, 0x5a, 0x12, 0x03,
+  0x81, 0x48, 0x46, 0x6a, 0xea, 0x4b, 0x9a, 0x1c, 0xa5, 0x20, 0x55, 0xc5, 0x3f, 0x3c, 0x54, 0xd3,
+  0x7c, 0x91, 0xe5, 0x2f, 0x71, 0xbb, 0x72, 0x69, 0xeb, 0xc5, 0x67, 0x4d, 0x72, 0x4b, 0x98, 0xbb,
+  0x98, 0x07, 0xad, 0x48, 0x83, 0x35, 0xdb, 0x45, 0xde, 0xa5, 0x8f, 0x90, 0xe8, 0x2b, 0x8c, 0x53,
+  0x07, 0x5a, 0x31, 0x0f, 0x96, 0xa2, 0x45, 0x47, 0x62, 0x60, 0xbc, 0x53, 0x1b, 0x8a, 0xd7, 0x11,
+  0xee, 0xd3, 0x4d, 0x0e, 0x3b, 0x8a, 0x83, 0x35, 0x21, 0x5e, 0x28, 0xa2, 0xaf, 0x4a, 0xe5, 0xf5,
+  0x23, 0xef, 0x52, 0xa0, 0xc8, 0xac, 0x30, 0xcf, 0x9a, 0x6d, 0x32, 0xd8, 0x8e, 0x31, 0x48, 0xbc,
+  0x9a, 0x9a, 0xae, 0xd5, 0x6c, 0x5a, 0xd8, 0x97, 0x6f, 0x15, 0x1b, 0x75, 0xad, 0x31, 0x5e, 0xec,
+  0x55, 0x87, 0x11, 0xe8, 0x33, 0x4f, 0x61, 0x81, 0x55, 0x05, 0x7a, 0x37, 0x2b, 0xa9, 0x18, 0xeb,
+  0x53, 0x2a, 0xf1, 0x58, 0xe1, 0x7d, 0xe6, 0xee, 0x68, 0xc6, 0x3f, 0x14, 0xa9, 0xcd, 0x66, 0xdf,
+  0xef, 0xac, 0x5a, 0xd8, 0x90, 0xaf, 0x15, 0x19, 0xeb, 0x57, 0x8b, 0xf7, 0x6d, 0x61, 0xc4, 0x95,
+  0x06, 0x68, 0x71, 0x8a, 0xd1, 0xaf, 0xdc, 0xdc, 0xa5, 0xb8, 0xc5, 0xeb, 0x53, 0x05, 0xe2, 0xb2,
+  0xc2, 0xfb, 0xc9, 0xdc, 0xb6, 0x31, 0xb8, 0x34, 0xe4, 0x19, 0xac, 0xa2, 0xef, 0x5a, 0xc5, 0xf4,
+  0x1e, 0xc3, 0x8a, 0x8f, 0xbd, 0x56, 0x29, 0xf2, 0xc9, 0x58, 0xa8, 0x92, 0xa0, 0xc8, 0xa4, 0x71,
+  0x8a, 0xd2, 0xaa, 0xb5, 0x2b, 0x94, 0xb7, 0x11, 0x39, 0x35, 0x2e, 0xde, 0x2a, 0x70, 0xde, 0xf4,
+  0x1b, 0x65, 0x32, 0x33, 0xd6, 0xa4, 0x41, 0x9a, 0xc2, 0x8b, 0xbd, 0x5b, 0x1a, 0x74, 0x15, 0x86,
+  0x05, 0x30, 0x75, 0xa3, 0x10, 0xf9, 0x6a, 0x24, 0x8a, 0x8e, 0xc4, 0xca, 0xbc, 0x53, 0x1f, 0x8a,
+  0xd7, 0x11, 0xee, 0xd3, 0x4c, 0xa8, 0xee, 0x61, 0x95, 0xcd, 0x3d, 0x78, 0xae, 0xa8, 0x2e, 0x49,
+  0x73, 0x1f, 0x21, 0x71, 0x4f, 0x34, 0x81, 0x71, 0x4a, 0xa2, 0xe7, 0x97, 0x31, 0x49, 0xd8, 0x78,
+  0x34, 0x85, 0x73, 0x55, 0x51, 0xf3, 0xc7, 0x94, 0xa5, 0xa0, 0xaa, 0x31, 0x4e, 0x27, 0x34, 0x42,
+  0x5c, 0x91, 0xe5, 0x2c, 0x6e, 0xce, 0x69, 0xeb, 0xc5, 0x67, 0x4d, 0x7b, 0x37, 0x72, 0xb7, 0x02,
+  0x33, 0x40, 0x5c, 0x54, 0xcd, 0x73, 0x4f, 0x98, 0xb4, 0xc7, 0xe6, 0x90, 0xae, 0x6a, 0xaa, 0xbf,
+  0x68, 0xac, 0x52, 0xd0, 0x55, 0x18, 0xa7, 0x1e, 0x69, 0xa9, 0x5a, 0x1c, 0xa5, 0x0d, 0x0b, 0xcd,
+  0x48, 0x0e, 0x2a, 0x29, 0x7e, 0xed, 0x97, 0xb8, 0x84, 0x66, 0x85, 0x5c, 0x54, 0x38, 0xfb, 0xfc,
+  0xe5, 0xa6, 0x3f, 0x34, 0xdd, 0xb4, 0xea, 0xfe, 0xf0, 0xa8, 0xe8, 0x3d, 0x78, 0xa5, 0x3c, 0xd5,
+  0x39, 0x7b, 0x9c, 0x85, 0x21, 0x02, 0xe2, 0x9e, 0x0f, 0x15, 0x14, 0x9f, 0xb3, 0x2f, 0x71, 0x0a,
+  0xe6, 0x95, 0x46, 0x2a, 0x14, 0x6d, 0x3e, 0x62, 0xae, 0x38, 0x9c, 0xd3, 0x76, 0x51, 0x57, 0xf7,
+  0x8e, 0xe5, 0xad, 0x09, 0x01, 0xc5, 0x21, 0x19, 0xaa, 0x94, 0xb9, 0xa1, 0xca, 0x52, 0x05, 0x5c,
+  0x53, 0xf3, 0x53, 0x4d, 0xfb, 0x35, 0x62, 0xb7, 0x1a, 0x57, 0x34, 0xf5, 0xe2, 0xa2, 0x0b, 0x92,
+  0x5c, 0xc5, 0xdc, 0x53, 0xcd, 0x34, 0x2d, 0x2a, 0x8b, 0x9e, 0x5c, 0xc5, 0x27, 0x62, 0x40, 0x71,
+  0x48, 0x46, 0x6a, 0xaa, 0x4b, 0x9e, 0x3c, 0xa5, 0x2d, 0x0c, 0x65, 0x1c, 0x53, 0x1f, 0x8a, 0xf4,
+  0x6b, 0xe9, 0x4a, 0xe7, 0xc8, 0x47, 0x71, 0x53, 0x9a, 0x90, 0x8e, 0x29, 0x61, 0xfd, 0xea, 0x6d,
+  0xb2, 0x9e, 0xe4, 0x67, 0xad, 0x4a, 0x83, 0x35, 0x86, 0x1d, 0xf3, 0x54, 0x69, 0x9a, 0x3d, 0x81,
+  0xc6, 0x29, 0x8b, 0xd6, 0xa6, 0xbb, 0xb5, 0x5b, 0x15, 0x1d, 0x89, 0x82, 0xf1, 0x4c, 0x6e, 0x0d,
+  0x6b, 0x89, 0xf7, 0x60, 0x9a, 0x2a, 0x3b, 0x8e, 0x41, 0x9a, 0x7b, 0x0e, 0x29, 0xd2, 0x57, 0xa5,
+  0x72, 0xba, 0x91, 0xf7, 0xa9, 0x94, 0x71, 0x58, 0xe1, 0x5f, 0x34, 0x9d, 0xcb, 0x63, 0x5c, 0x62,
+  0x91, 0x39, 0x35, 0x13, 0x76, 0xad, 0x62, 0xd6, 0xc4, 0xdb, 0x78, 0xa8, 0x8f, 0x5a, 0xd3, 0x17,
+  0xee, 0xa5, 0x62, 0xa2, 0x48, 0x83, 0x34, 0xae, 0x31, 0x54, 0x97, 0xee, 0x6e, 0x3e, 0xa3, 0x07,
+  0x5a, 0x99, 0x57, 0x8a, 0xcb, 0x09, 0xef, 0x5e, 0xe6, 0x8c, 0x63, 0xf1, 0x4a, 0x9c, 0xd6, 0x49,
+  0xfe, 0xfa, 0xc5, 0xad, 0x89, 0x08, 0xe2, 0xa3, 0xef, 0x57, 0x8b, 0xf7, 0x5a, 0xb1, 0x51, 0x25,
+  0x41, 0x91, 0x48, 0xe3, 0x15, 0xa4, 0xd5, 0xa8, 0xdc, 0x69, 0xea, 0x22, 0xf5, 0xa9, 0xb6, 0xf1,
+  0x59, 0xe1, 0x7d, 0xe8, 0xbb, 0x96, 0xc8, 0x9b, 0xad, 0x3e, 0x31, 0x9a, 0xc6, 0x9b, 0xbd, 0x5b,
+  0x17, 0xd0, 0x7b, 0x0e, 0x2a, 0x31, 0xd6, 0x9e, 0x29, 0xf2, 0xcd, 0x24, 0x54, 0x49, 0x94, 0x71,
+  0x4d, 0x71, 0x8a, 0xd6, 0xb6, 0x94, 0xae, 0x54, 0x77, 0x04, 0xe4, 0xd4, 0x85, 0x78, 0xa9, 0xc3,
+  0xfb, 0xd4, 0xdb, 0x65, 0xbd, 0xc8, 0xcf, 0x5a, 0x91, 0x06, 0x6b, 0x1a, 0x0e, 0xf5, 0x1a, 0x2d,
+  0xec, 0x62, 0x03, 0x8a, 0x42, 0x33, 0x5e, 0x9c, 0xe5, 0xcf, 0x1e, 0x53, 0xe3, 0xd0, 0xaa, 0x31,
+  0x4e, 0xce, 0x69, 0x42, 0x5c, 0x91, 0xe5, 0x2b, 0x71, 0x36, 0xf3, 0x4e, 0x5e, 0x2b, 0x38, 0x2f,
+  0x67, 0x2e, 0x62, 0xef, 0x71, 0x4f, 0x34, 0x81, 0x71, 0x4a, 0x6b, 0x9e, 0x5c, 0xc5, 0x26, 0x3c,
+  0x1a, 0x42, 0xb9, 0xaa, 0xa8, 0xfd, 0xa2, 0xb1, 0x4b, 0x41, 0x54, 0x62, 0x9c, 0x4e, 0x68, 0x8c,
+  0xb9, 0x63, 0xca, 0x58, 0x9b, 0x29, 0xc0, 0xe2, 0xa2, 0x9f, 0xee, 0xdd, 0xcb, 0xdc, 0x08, 0xcd,
+  0x01, 0x71, 0x52, 0xe3, 0x79, 0x73, 0x14, 0x98, 0xfc, 0xd2, 0x6d, 0xcd, 0x3a, 0xaf, 0xda, 0xa2,
+  0x96, 0x83, 0x97, 0x8a, 0x53, 0xcd, 0x3e, 0x6f, 0x73, 0x90, 0xa4, 0x20, 0x5a, 0x78, 0x38, 0xa8,
+  0xa7, 0xfb, 0xa2, 0xf7, 0x10, 0x8c, 0xd2, 0xa8, 0xc5, 0x47, 0x2f, 0xbf, 0xce, 0x5a, 0x63, 0xb3,
+  0x9a, 0x6e, 0xca, 0x75, 0x7f, 0x7a, 0x52, 0xd0, 0x78, 0xe2, 0x83, 0xcd, 0x53, 0x95, 0xe3, 0xc8,
+  0x52, 0x00, 0xb8, 0xa7, 0xe6, 0xa2, 0x9b, 0xf6, 0x6a, 0xc5, 0xee, 0x21, 0x5c, 0xd2, 0xa8, 0xc5,
+  0x44, 0x57, 0x2c, 0xb9, 0x8b, 0xb8, 0xe3, 0xcd, 0x26, 0xca, 0x2a, 0x2f, 0x68, 0xee, 0x52, 0x76,
+  0x1e, 0x0e, 0x29, 0x08, 0xcd, 0x54, 0xe5, 0xcf, 0x1e, 0x52, 0x90, 0x2a, 0xe2, 0x9f, 0x9a, 0x50,
+  0x7e, 0xce, 0x3c, 0xa5, 0x6e, 0x37, 0x6e, 0x69, 0xeb, 0xc5, 0x67, 0x05, 0xc9, 0x2e, 0x62, 0xef,
+  0x73, 0x00, 0xf5, 0xa9, 0x10, 0x66, 0xbb, 0x68, 0x3b, 0xd5, 0x68, 0xf9, 0x0e, 0x82, 0xb8, 0xc5,
+  0x31, 0x7a, 0xd2, 0xc4, 0x3b, 0x54, 0x49, 0x15, 0x1d, 0x89, 0x80, 0xe2, 0x98, 0xfc, 0x1a, 0xdb,
+  0x13, 0xa5, 0x34, 0xd1, 0x51, 0xdc, 0x54, 0x19, 0xa9, 0x08, 0xe2, 0x8a, 0x3a, 0xd2, 0xb9, 0x5d,
+  0x48, 0xfb, 0xd4, 0xa8, 0x38, 0xac, 0x30, 0xcf, 0x9a, 0x6d, 0x33, 0x47, 0xb0, 0x8e, 0x31, 0x48,
+  0x9d, 0x6a, 0x2a, 0xbb, 0x55, 0xb1, 0x4b, 0x62, 0x6c, 0x71, 0x51, 0x37, 0x5a, 0xd7, 0x15, 0xee,
+  0xc5, 0x58, 0xa8, 0x8f, 0x8c, 0x66, 0x9e, 0xc3, 0x8a, 0xa8, 0x7f, 0x06, 0xe5, 0x75, 0x23, 0x1d,
+  0x6a, 0x65, 0x1c, 0x56, 0x38, 0x4f, 0x79, 0xbb, 0x96, 0xc6, 0x38, 0xc5, 0x2a, 0x56, 0x4d, 0xfe,
+  0xfa, 0xc5, 0xad, 0x89, 0x48, 0xe2, 0xa2, 0x3d, 0x6b, 0x4c, 0x5f, 0xbb, 0x6b, 0x15, 0x12, 0x54,
+  0x19, 0xa1, 0xc6, 0x2b, 0x46, 0xbf, 0x73, 0x72, 0x96, 0xe3, 0x17, 0xad, 0x4c, 0x07, 0x15, 0x96,
+  0x13, 0xde, 0x4e, 0xe5, 0xb1, 0x8d, 0xc1, 0xa7, 0x46, 0x33, 0x58, 0xc5, 0xfe, 0xfa, 0xc5, 0xf4,
+  0x1e, 0xc3, 0x8a, 0x8f, 0xbd, 0x56, 0x2d, 0xf2, 0xc9, 0x58, 0xa8, 0x93, 0x20, 0xe2, 0x9a, 0xe3,
+  0x15, 0xad, 0x5d, 0x28, 0xdc, 0x6b, 0x71, 0x13, 0xad, 0x4d, 0x8e, 0x2a, 0x30, 0xde, 0xf4, 0x1b,
+  0x65, 0xb2, 0x26, 0xeb, 0x52, 0x20, 0xcd, 0x63, 0x45, 0xde, 0xad, 0x8b, 0xe8, 0x2b, 0x0e, 0x29,
+  0x83, 0xad, 0x18, 0x97, 0x6a, 0x89, 0x22, 0xe3, 0xb1, 0x32, 0x8e, 0x29, 0x8f, 0xc5, 0x6b, 0x88,
+  0xd2, 0x9a, 0x68, 0x71, 0xdc, 0xc4, 0xdb, 0x9a, 0x70, 0xe2, 0xba, 0xa2, 0xb9, 0x25, 0xcc, 0x7c,
+  0x85, 0xc5, 0x3c, 0xd2, 0x05, 0xc5, 0x29, 0xae, 0x79, 0x73, 0x16, 0x9d, 0x87, 0x83, 0x48, 0x57,
+  0x35, 0x53, 0x97, 0xb4, 0x5c, 0xa5, 0x2d, 0x05, 0x03, 0x14, 0xec, 0xe6, 0x94, 0x65, 0xc9, 0x1e,
+  0x52, 0x84, 0xd9, 0x4e, 0x1c, 0x54, 0x41, 0x7b, 0x37, 0x72, 0xef, 0x70, 0x23, 0x34, 0x05, 0xc5,
+  0x29, 0x47, 0x9a, 0x5c, 0xc5, 0xa6, 0x3f, 0x34, 0x9b, 0x73, 0x4e, 0xa3, 0xf6, 0x8a, 0xc5, 0x2d,
+  0x05, 0x03, 0x14, 0xe3, 0xcd, 0x0a, 0x56, 0x8f, 0x21, 0x42, 0x04, 0xa7, 0x83, 0x8a, 0x8a, 0x7f,
+  0xba, 0xd4, 0xbd, 0xc4, 0x23, 0x34, 0xa1, 0x71, 0x52, 0xe3, 0x79, 0x73, 0x94, 0x98, 0xec, 0xe6,
+  0x93, 0x6e, 0x69, 0xd4, 0xfd, 0xe9, 0x4b, 0x41, 0xc3, 0x8a, 0x0f, 0x34, 0xdc, 0xbd, 0xde, 0x42,
+  0xd0, 0x05, 0xc5, 0x3c, 0x1a, 0x9a, 0x6f, 0xd9, 0x15, 0xb8, 0x85, 0x73, 0x4a, 0x06, 0x2a, 0x14,
+  0x6d, 0x2e, 0x72, 0xee, 0x3b, 0x39, 0xa4, 0xd9, 0x45, 0x4f, 0xde, 0x3b, 0x94, 0xb4, 0x1c, 0x0e,
+  0x28, 0x23, 0x34, 0xe5, 0x2e, 0x68, 0xf2, 0x94, 0x80, 0x2e, 0x29, 0xf9, 0xa5, 0x07, 0xec, 0xd5,
+  0x8b, 0xdc, 0x4d, 0xb9, 0xa7, 0x0e, 0x2a, 0x22, 0xb9, 0x25, 0xcc, 0x5d, 0xc5, 0x3c, 0xd2, 0x04,
+  0xa5, 0x35, 0xed, 0x1f, 0x31, 0x49, 0xd8, 0x78, 0x38, 0xa4, 0x23, 0x35, 0x53, 0x97, 0x3c, 0x79,
+  0x4a, 0x5a, 0x18, 0xca, 0x38, 0xa6, 0x38, 0xaf, 0x46, 0xbe, 0x94, 0x93, 0x3e, 0x3e, 0x3b, 0x8a,
+  0x95, 0x29, 0x1c, 0x52, 0xc3, 0xeb, 0x4d, 0xb6, 0x5b, 0xdc, 0x88, 0xf5, 0xa9, 0x50, 0x57, 0x3e,
+  0x1d, 0xde, 0xa3, 0x4c, 0xb7, 0xb0, 0x38, 0xa6, 0x2f, 0x5a, 0x55, 0xdd, 0xaa, 0xd8, 0xb8, 0xec,
+  0x4e, 0x07, 0x15, 0x1b, 0x75, 0xad, 0x71, 0x5a, 0x41, 0x58, 0x71, 0xdc, 0x74, 0x62, 0x9e, 0xc3,
+  0x8a, 0x74, 0xb5, 0xa3, 0x72, 0xba, 0x91, 0xf7, 0xa9, 0x90, 0x71, 0x58, 0xe1, 0x5d, 0xe4, 0xee,
+  0x68, 0xc6, 0xb8, 0xa4, 0x4e, 0xb5, 0x9c, 0xdf, 0xef, 0xac, 0x5a, 0xd8, 0x9b, 0x1c, 0x54, 0x47,
+  0xad, 0x69, 0x8b, 0xf7, 0x52, 0xb0, 0xe2, 0x48, 0x82, 0x95, 0xc7, 0x15, 0x6b, 0xf8, 0x37, 0x2b,
+  0xa8, 0xc1, 0xd6, 0xa6, 0x51, 0xc5, 0x65, 0x84, 0xf7, 0xaf, 0x72, 0xd8, 0xc7, 0xa5, 0x41, 0x9a,
+  0xc9, 0x3f, 0xdf, 0x58, 0xb5, 0xb1, 0x21, 0x1c, 0x54, 0x7d, 0xea, 0xf1, 0x7e, 0xeb, 0x56, 0x2a,
+  0x24, 0xa8, 0x38, 0xa4, 0x71, 0x5a, 0x4f, 0xf8, 0x37, 0x29, 0x6e, 0x22, 0xf5, 0xa9, 0xb1, 0xc5,
+  0x67, 0x85, 0xd6, 0x2e, 0xe5, 0xb2, 0x26, 0xeb, 0x4f, 0x8c, 0x56, 0x34, 0xdd, 0xeb, 0x58, 0xbe,
+  0x83, 0xd8, 0x71, 0x51, 0x8e, 0xb4, 0xf1, 0x4e, 0xd3, 0x56, 0x2a, 0x24, 0xca, 0x38, 0xa6, 0x38,
+  0xad, 0x6b, 0xe9, 0x4a, 0xe5, 0x47, 0x70, 0x4e, 0xb5, 0x31, 0x1c, 0x54, 0xe1, 0xf5, 0xa6, 0xdb,
+  0x29, 0xee, 0x44, 0x7a, 0xd4, 0x88, 0x2b, 0x0c, 0x3b, 0xbd, 0x46, 0x99, 0xa3, 0xd8, 0xc3, 0x07,
+  0x14, 0x11, 0x9a, 0xf4, 0xe5, 0x2e, 0x75, 0xca, 0x7c, 0x72, 0xd0, 0x50, 0xb8, 0xa7, 0x67, 0x34,
+  0xa3, 0x2e, 0x45, 0xca, 0x5e, 0xe2, 0x6c, 0xa7, 0x0e, 0x2a, 0x22, 0xbd, 0x9b, 0xe6, 0x2a, 0xf7,
+  0x03, 0xcd, 0x01, 0x71, 0x4a, 0x4b, 0x9d, 0xf3, 0x16, 0x98, 0xfc, 0xd2, 0x15, 0xcd, 0x39, 0xbf,
+  0x68, 0xac, 0x52, 0xd0, 0x50, 0x31, 0x4e, 0xce, 0x68, 0x52, 0xe5, 0x8f, 0x29, 0x42, 0x6c, 0xa7,
+  0x03, 0x8a, 0x98, 0x7e, 0xed, 0xdc, 0xbd, 0xc0, 0x8d, 0xd4, 0xa1, 0x71, 0x52, 0xe3, 0x79, 0x73,
+  0x96, 0x98, 0xec, 0xd2, 0x6d, 0xcd, 0x3a, 0x8f, 0xda, 0xe8, 0x52, 0xd0, 0x70, 0xe2, 0x94, 0xf3,
+  0x47, 0x37, 0xbb, 0xc8, 0x52, 0x10, 0x26, 0x29, 0xc0, 0xe2, 0xa6, 0x1f, 0xba, 0x2f, 0x70, 0x2b,
+  0x9a, 0x50, 0x31, 0x53, 0xcb, 0xef, 0x73, 0x94, 0x98, 0xec, 0xe6, 0x93, 0x65, 0x15, 0x3f, 0x7a,
+  0x5a, 0xd0, 0x70, 0xe2, 0x83, 0xcd, 0x37, 0x2b, 0xc7, 0x90, 0xa4, 0x01, 0x71, 0x4f, 0xcd, 0x4c,
+  0x1f, 0xb2, 0x56, 0x2b, 0x71, 0x36, 0xe6, 0x94, 0x0d, 0xb5, 0x0a, 0x3c, 0xb2, 0xe6, 0x2e, 0xe3,
+  0x89, 0xcd, 0x26, 0xca, 0x26, 0xbd, 0xa3, 0xb9, 0x49, 0xd8, 0x70, 0x38, 0xa0, 0x8c, 0xd3, 0x94,
+  0xb9, 0xe3, 0xca, 0x5a, 0x14, 0x2e, 0x29, 0xd9, 0xa5, 0x19, 0x7b, 0x35, 0xca, 0x56, 0xe2, 0x6c,
+  0xcd, 0x38, 0x71, 0x51, 0x15, 0xc8, 0xf9, 0x8b, 0xbd, 0xcc, 0x03, 0xd6, 0xa4, 0x8c, 0x57, 0x65,
+  0x07, 0x7a, 0xad, 0x1f, 0x20, 0xf6, 0x15, 0xc5, 0x31, 0x7a, 0xd1, 0x88, 0x76, 0xa8, 0x92, 0x2a,
+  0x3b, 0x13, 0x01, 0xc5, 0x31, 0xfa, 0xd6, 0xb8, 0x9d, 0x29, 0xab, 0x15, 0x1d, 0xc5, 0x8c, 0x54,
+  0x8c, 0x38, 0xa2, 0x86, 0xb4, 0x9b, 0x2b, 0xa9, 0x1f, 0x7a, 0x95, 0x07, 0x15, 0x86, 0x15, 0xde,
+  0x6e, 0xe5, 0xbd, 0x84, 0x71, 0x48, 0x9d, 0x6a, 0x6a, 0xbb, 0x56, 0xb1, 0x6b, 0x62, 0x6c, 0x71,
+  0x51, 0x37, 0x5a, 0xd7, 0x17, 0xa4, 0x55, 0x87, 0x11, 0xf1, 0x8a, 0x7b, 0x0e, 0x2a, 0xa1, 0xfc,
+  0x1b, 0x95, 0xd4, 0x8c, 0x75, 0xa9, 0x94, 0x71, 0x58, 0xe1, 0x35, 0x6e, 0xe6, 0x8c, 0x63, 0x8a,
+  0x54, 0xeb, 0x59, 0x37, 0xfb, 0xeb, 0x16, 0xb6, 0x25, 0x23, 0x8a, 0x88, 0xf5, 0xad, 0x31, 0x9a,
+  0x5a, 0xc3, 0x81, 0x2a, 0x0a, 0x1c, 0x56, 0x8f, 0xf8, 0x37, 0x29, 0x6e, 0x31, 0x7a, 0xd4, 0xe0,
+  0x71, 0x59, 0x61, 0x35, 0x4e, 0xe5, 0xb2, 0x36, 0xeb, 0x4e, 0x8c, 0x56, 0x30, 0x7f, 0xbe, 0xb1,
+  0x7d, 0x07, 0xb0, 0xe2, 0xa3, 0xef, 0x55, 0x8b, 0xd2, 0x4a, 0xc5, 0x44, 0x99, 0x07, 0x14, 0xd7,
+  0x15, 0xad, 0x5d, 0x28, 0xdc, 0xa5, 0xb8, 0x89, 0xd6, 0xa6, 0xc7, 0x15, 0x18, 0x5d, 0x60, 0xee,
+  0x5b, 0xdc, 0x89, 0xba, 0xd4, 0x91, 0x8a, 0xc2, 0x8b, 0xbd, 0x5b, 0x17, 0xd0, 0x57, 0x1c, 0x53,
+  0x07, 0x5a, 0x31, 0x2e, 0xd5, 0x15, 0x8a, 0x8e, 0xc4, 0xca, 0x38, 0xa6, 0x38, 0xad, 0xb1, 0x1a,
+  0x52, 0x4d, 0x15, 0x1d, 0xcc, 0x4d, 0xb9, 0xa7, 0x0e, 0x2b, 0xa9, 0x2e, 0x47, 0xcc, 0x7c, 0x85,
+  0xee, 0x1d, 0x68, 0x09, 0x8a, 0x52, 0x5e, 0xd1, 0xf3, 0x14, 0x9d, 0x87, 0x03, 0x8a, 0x36, 0xe6,
+  0x9c, 0xa5, 0xed, 0x17, 0x29, 0x4b, 0x41, 0x40, 0xc5, 0x3b, 0x39, 0xa4, 0xa5, 0xc8, 0xb9, 0x4b,
+  0x13, 0x65, 0x38, 0x1c, 0x54, 0xc5, 0x7b, 0x37, 0x72, 0xef, 0x70, 0x23, 0x75, 0x01, 0x71, 0x49,
+  0xc7, 0x99, 0xf3, 0x14, 0x98, 0xfc, 0xd2, 0x6d, 0xcd, 0x13, 0x7e, 0xd5, 0x58, 0xa5, 0xa0, 0xa0,
+  0x6d, 0xa7, 0x75, 0xa1, 0x4a, 0xcb, 0x90, 0xb4, 0x26, 0xca, 0x70, 0x38, 0xa9, 0x8f, 0xee, 0xb5,
+  0x2b, 0x70, 0xc6, 0x69, 0x42, 0xe2, 0xa7, 0x96, 0xef, 0x9c, 0xb4, 0xc7, 0x67, 0x34, 0x9b, 0x33,
+  0x4e, 0x7f, 0xbd, 0x29, 0x68, 0x38, 0x71, 0x47, 0x5a, 0x39, 0xb4, 0xe4, 0x29, 0x00, 0x5c, 0x53,
+  0xb3, 0x53, 0x17, 0xec, 0x8b, 0xdc, 0x36, 0xe6, 0x94, 0x0d, 0xb5, 0x3c, 0xb6, 0x7c, 0xe5, 0x26,
+  0x3b, 0x39, 0xa4, 0xd9, 0x44, 0xff, 0x00, 0x7b, 0xa9, 0x6b, 0x41, 0xc0, 0xe2, 0x8c, 0x6e, 0xa6,
+  0xe5, 0xcc, 0xb9, 0x0a, 0x42, 0x85, 0xc5, 0x2e, 0x6a, 0x62, 0xfd, 0x9a, 0xb1, 0x5b, 0x86, 0xdc,
+  0xd2, 0x8e, 0x2a, 0x52, 0xe4, 0x7c, 0xc5, 0xdc, 0x5e, 0xb4, 0x04, 0xa5, 0x25, 0xed, 0x1f, 0x31,
+  0x69, 0xd8, 0x70, 0x38, 0xa3, 0x19, 0xa7, 0x29, 0x73, 0xae, 0x52, 0x96, 0x86, 0x32, 0x8e, 0x29,
+  0x8e, 0x2b, 0xd2, 0xaf, 0xa5, 0x24, 0x7c, 0x7c, 0x77, 0x15, 0x05, 0x4a, 0x47, 0x15, 0x38, 0x7d,
+  0x69, 0xbb, 0x94, 0xf7, 0x22, 0x3d, 0x6a, 0x54, 0x1c, 0x56, 0x18, 0x67, 0x7a, 0x8e, 0xe6, 0x8f,
+  0x60, 0x71, 0x4c, 0x5e, 0xb4, 0xab, 0xbb, 0x55, 0x45, 0x47, 0x62, 0x70, 0x38, 0xa8, 0x9b, 0xad,
+  0x6b, 0x8a, 0xd2, 0x0a, 0xc5, 0x47, 0x71, 0xf1, 0x8a, 0x7b, 0x0e, 0x29, 0xd2, 0xfe, 0x09, 0x5d,
+  0x48, 0xfb, 0xd4, 0xc8, 0x38, 0xac, 0x30, 0x9a, 0xc9, 0xdc, 0xb6, 0x35, 0xc5, 0x22, 0x75, 0xa8,
+  0x9b, 0xfd, 0xf5, 0x8b, 0x5b, 0x13, 0x63, 0x8a, 0x89, 0xba, 0xd6, 0x98, 0xcd, 0x12, 0xb1, 0x51,
+  0x24, 0x8c, 0x52, 0xb8, 0xe2, 0xad, 0x7f, 0x06, 0xe3, 0xea, 0x30, 0x75, 0xa9, 0x94, 0x71, 0x59,
+  0x61, 0x35, 0xbd, 0xcd, 0x18, 0xc7, 0x1c, 0xd2, 0xc6, 0x2b, 0x14, 0xff, 0x00, 0x7d, 0x62, 0xd6,
+  0xc4, 0xa4, 0x71, 0x50, 0xf7, 0xab, 0xc6, 0x68, 0xd5, 0x8a, 0x81, 0x32, 0x0e, 0x29, 0x1c, 0x56,
+  0xb3, 0xfe, 0x0d, 0xc6, 0xb7, 0x11, 0x3a, 0xd4, 0xd8, 0xe2, 0xb3, 0xc2, 0x6b, 0x17, 0x72, 0xd9,
+  0x13, 0x75, 0xa7, 0xc6, 0x2b, 0x0a, 0x4f, 0xf7, 0xd6, 0x34, 0xe8, 0x3d, 0x87, 0x15, 0x18, 0xeb,
+  0x4f, 0x15, 0xa4, 0xd5, 0x8a, 0x8e, 0xc4, 0xca, 0x38, 0xa6, 0x38, 0xad, 0xab, 0xe9, 0x48, 0x71,
+  0xdc, 0x10, 0x73, 0x53, 0x11, 0xc5, 0x4e, 0x1b, 0x5a, 0x6e, 0xe5, 0xbd, 0xc8, 0x8f, 0x5a, 0x91,
+  0x05, 0x61, 0x87, 0x77, 0xaa, 0xee, 0x5b, 0xd8, 0xc3, 0x07, 0x14, 0x63, 0x35, 0xe9, 0x39, 0x73,
+  0xae, 0x53, 0xe3, 0xd6, 0x82, 0x85, 0xc5, 0x2e, 0x73, 0x42, 0x97, 0xb3, 0x5c, 0xa5, 0x6e, 0x1b,
+  0x33, 0x4e, 0x1c, 0x54, 0xa5, 0xec, 0xdf, 0x31, 0x77, 0xb8, 0x75, 0xa5, 0x0b, 0x8a, 0x4d, 0x73,
+  0xbe, 0x62, 0x93, 0x17, 0x34, 0x6d, 0xcd, 0x12, 0x7e, 0xd1, 0x58, 0xb5, 0xa0, 0xa0, 0x6d, 0xa5,
+  0xce, 0x69, 0x29, 0x72, 0xae, 0x42, 0x83, 0x65, 0x38, 0x1c, 0x52, 0x8f, 0xee, 0xb5, 0x2f, 0x70,
+  0xc6, 0xea, 0x50, 0xb8, 0xa9, 0x71, 0xbb, 0xe7, 0x29, 0x31, 0x73, 0x46, 0xdc, 0xd1, 0x27, 0xed,
+  0x74, 0x29, 0x68, 0x28, 0xe2, 0x97, 0xad, 0x1c, 0xda, 0x72, 0x16, 0x83, 0x66, 0x29, 0xc0, 0xe2,
+  0x94, 0x7f, 0x74, 0x56, 0xe1, 0xb7, 0x34, 0xa0, 0x62, 0xa7, 0x97, 0x5e, 0x72, 0xd3, 0x17, 0x39,
+  0xa3, 0x65, 0x12, 0xfd, 0xe9, 0x4b, 0x41, 0xc3, 0x8a, 0x3e, 0xf5, 0x0e, 0x57, 0x5c, 0x85, 0x21,
+  0x42, 0xe2, 0x97, 0x34, 0xa2, 0xfd, 0x96, 0x85, 0xee, 0x1b, 0x73, 0x4a, 0x06, 0xda, 0x95, 0x1e,
+  0x57, 0xce, 0x5a, 0x62, 0xe7, 0x34, 0x6c, 0xa5, 0x25, 0xed, 0x1d, 0xca, 0x4e, 0xc3, 0x81, 0xc5,
+  0x18, 0xcd, 0x0e, 0x5c, 0xeb, 0x94, 0xa4, 0x28, 0x5c, 0x52, 0xe7, 0x34, 0x29, 0x7b, 0x35, 0xca,
+  0x5e, 0xe1, 0xb3, 0x34, 0xe1, 0xc5, 0x4a, 0x5c, 0x8f, 0x98, 0xab, 0xdc, 0xc0, 0x3d, 0x6a, 0x48,
+  0xc5, 0x75, 0xd0, 0x7f, 0xbd, 0x67, 0xc8, 0x3d, 0x85, 0x71, 0x4c, 0x5e, 0xb4, 0x62, 0x74, 0xa8,
+  0xac, 0x5c, 0x76, 0x27, 0x03, 0x8a, 0x8d, 0xc5, 0x6b, 0x89, 0xd2, 0x9a, 0xb0, 0xe3, 0xb8, 0xb1,
+  0x8a, 0x95, 0x87, 0x14, 0x50, 0xfe, 0x13, 0x2b, 0xa9, 0x0f, 0x7a, 0x99, 0x07, 0x15, 0x86, 0x17,
+  0x59, 0xbb, 0x9a, 0x3d, 0x84, 0x71, 0x48, 0x83, 0x9a, 0x8a, 0xaf, 0xf7, 0xc5, 0xad, 0x89, 0xb1,
+  0xc5, 0x44, 0xc3, 0x9a, 0xdb, 0x17, 0xa4, 0x55, 0x87, 0x11, 0xf1, 0x8a, 0x7b, 0x0e, 0x2a, 0xa1,
+  0xfc, 0x12, 0xba, 0x91, 0x8e, 0xb5, 0x32, 0x8e, 0x2b, 0x0c, 0x26, 0xad, 0xdc, 0xb6, 0x31, 0xc5,
+  0x2a, 0x0e, 0x6b, 0x36, 0xff, 0x00, 0x7c, 0x5a, 0xd8, 0x94, 0x8e, 0x2a, 0x23, 0xd6, 0xb4, 0xc6,
+  0x69, 0x6b, 0x15, 0x02, 0x54, 0x1c, 0x50, 0xe2, 0xad, 0xff, 0x00, 0x04, 0xa5, 0xb8, 0xc5, 0xeb,
+  0x53, 0x81, 0xc5, 0x67, 0x84, 0xd5, 0x3b, 0x96, 0xc8, 0x98, 0x73, 0x4f, 0x8c, 0x56, 0x10, 0x7f,
+  0xbe, 0x2f, 0xa0, 0xf6, 0x1c, 0x54, 0x5d, 0xea, 0xf1, 0x7a, 0x49, 0x58, 0xa8, 0x93, 0xa0, 0xe2,
+  0x9a, 0xe2, 0xb5, 0xab, 0xfc, 0x11, 0xad, 0xc4, 0x41, 0xcd, 0x4d, 0x8e, 0x2a, 0x30, 0xba, 0xc1,
+  0xdc, 0xb7, 0xb9, 0x13, 0x75, 0xa9, 0x23, 0x15, 0x85, 0x17, 0xfb, 0xd3, 0x4e, 0x82, 0xb8, 0xe2,
+  0x98, 0x3a, 0xd1, 0x89, 0xd2, 0xa2, 0xb1, 0x51, 0xd8, 0x99, 0x47, 0x14, 0xc7, 0x15, 0xb6, 0x23,
+  0x4a, 0x4a, 0xc3, 0x8e, 0xe6, 0x26, 0xdc, 0xd2, 0x8e, 0x2b, 0xa9, 0x2e, 0x47, 0xcc, 0x7c, 0x85,
+  0xee, 0x2f, 0x5a, 0x5d, 0x98, 0xa4, 0xd7, 0xb4, 0x7c, 0xc5, 0xa7, 0x61, 0x73, 0x8a, 0x36, 0xe6,
+  0x87, 0x2f, 0x69, 0xee, 0x94, 0xb4, 0x14, 0x0c, 0x52, 0xe7, 0x34, 0x29, 0x72, 0x2e, 0x52, 0xd0,
+  0x6c, 0xa7, 0x03, 0x8a, 0x94, 0xbd, 0x9e, 0xa5, 0x5e, 0xe1, 0x8d, 0xd4, 0xa1, 0x71, 0x49, 0xc7,
+  0x99, 0xf3, 0x96, 0x98, 0xb9, 0xa3, 0x6e, 0x68, 0x6f, 0xda, 0xe8, 0x52, 0xd0, 0x50, 0x36, 0xd2,
+  0xe7, 0x34, 0xb9, 0xac, 0xb9, 0x0a, 0x41, 0xb2, 0x9c, 0x0e, 0x29, 0x2f, 0xdd, 0x6a, 0x5e, 0xe1,
+  0x8c, 0xd2, 0x85, 0xc5, 0x2e, 0x5b, 0xbe, 0x72, 0x93, 0x17, 0x39, 0xa3, 0x66, 0x69, 0x4b, 0xf7,
+  0xa5, 0xad, 0x07, 0x0e, 0x28, 0xeb, 0x47, 0x36, 0x9c, 0x85, 0x21, 0x76, 0xe2, 0x97, 0x34, 0x93,
+  0xf6, 0x45, 0x6e, 0x1b, 0x73, 0x4a, 0x06, 0xda, 0x9e, 0x5b, 0x3e, 0x72, 0xd3, 0x17, 0x39, 0xa3,
+  0x65, 0x0f, 0xf7, 0xba, 0x94, 0xb4, 0x1c, 0x0e, 0x28, 0xc6, 0xea, 0x1c, 0xb9, 0x97, 0x21, 0x68,
+  0x50, 0xb8, 0xa5, 0xcd, 0x24, 0xfd, 0x9e, 0x85, 0x6e, 0x1b, 0x73, 0x4a, 0x3e, 0x5a, 0x94, 0xb9,
+  0x1f, 0x31, 0x69, 0x8b, 0xd6, 0x8d, 0x98, 0xa4, 0xd7, 0xb4, 0xf7, 0x8a, 0x4e, 0xc3, 0xb3, 0x8a,
+  0x36, 0xe6, 0x87, 0x2e, 0x75, 0xca, 0x52, 0xd0, 0xc6, 0x51, 0xc5, 0x31, 0xc5, 0x7a, 0x58, 0x8f,
+  0xe1, 0x23, 0xe3, 0xe3, 0xb8, 0xa8, 0x39, 0xa9, 0x48, 0xe2, 0x96, 0x1f, 0xf8, 0x4e, 0xe5, 0xbd,
+  0xc8, 0x88, 0xe6, 0xa5, 0x41, 0xc5, 0x61, 0x86, 0xfe, 0x23, 0xb9, 0x6f, 0x60, 0x71, 0x4c, 0x51,
+  0xcd, 0x4d, 0x7f, 0xe2, 0xa2, 0xe3, 0xb1, 0x38, 0x1c, 0x54, 0x4c, 0x39, 0xad, 0xb1, 0x5f, 0x02,
+  0xb0, 0xe3, 0xb8, 0xf8, 0xc5, 0x3d, 0x87, 0x14, 0xe9, 0x7f, 0x04, 0xae, 0xa4, 0x58, 0xe6, 0xa7,
+  0x41, 0xc5, 0x61, 0x84, 0xf8, 0x9d, 0xcd, 0x18, 0xd7, 0x14, 0x88, 0x39, 0xac, 0xe7, 0xfc, 0x62,
+  0xd6, 0xc4, 0xd8, 0xe2, 0xa2, 0x61, 0xcd, 0x6b, 0x8c, 0xd9, 0x58, 0x70, 0x24, 0x8c, 0x52, 0xb8,
+  0xe2, 0xad, 0x7f, 0x04, 0xae, 0xa3, 0x14, 0x73, 0x53, 0x28, 0xe2, 0xb1, 0xc1, 0xf5, 0xb9, 0x6c,
+  0x63, 0x8a, 0x58, 0xc5, 0x64, 0xbf, 0x8c, 0x68, 0xb6, 0x25, 0x23, 0x8a, 0x87, 0x1c, 0xd5, 0xe3,
+  0x37, 0x56, 0x1c, 0x09, 0x90, 0x71, 0x48, 0xe2, 0xb5, 0x9f, 0xf0, 0x4a, 0x5b, 0x8d, 0x41, 0xcd,
+  0x4f, 0x8e, 0x2b, 0x3c, 0x27, 0xc2, 0xee, 0x5b, 0x22, 0x61, 0xcd, 0x3e, 0x31, 0x58, 0x52, 0xfe,
+  0x31, 0x7d, 0x07, 0xb0, 0xe2, 0xa2, 0x03, 0x9a, 0x78, 0xaf, 0x8d, 0x58, 0xa8, 0xec, 0x4e, 0xa3,
+  0x8a, 0x63, 0x8a, 0xda, 0xbf, 0xf0, 0x8a, 0x8e, 0xe0, 0x83, 0x9a, 0x98, 0x8e, 0x2a, 0x70, 0xdf,
+  0xc3, 0x77, 0x29, 0xee, 0x44, 0x47, 0x35, 0x24, 0x62, 0xb0, 0xc3, 0xff, 0x00, 0x15, 0xdc, 0xd1,
+  0xec, 0x61, 0xe7, 0x14, 0x63, 0x35, 0xe9, 0x39, 0x73, 0xfb, 0xa7, 0xc7, 0xa1, 0x76, 0xe2, 0x97,
+  0x39, 0xa5, 0xcd, 0xec, 0xfd, 0xd2, 0x96, 0xa1, 0xb3, 0x34, 0xbd, 0x29, 0x5b, 0xd9, 0xfb, 0xc5,
+  0x27, 0x71, 0x7e, 0xf5, 0x2e, 0xdc, 0x52, 0x6b, 0x9f, 0xde, 0x2d, 0x3b, 0x0b, 0x9a, 0x36, 0xe6,
+  0x93, 0x7e, 0xd3, 0x42, 0x96, 0x82, 0xe3, 0x6d, 0x2e, 0x73, 0x47, 0x37, 0x2f, 0xb8, 0x5a, 0x17,
+  0x65, 0x2e, 0x71, 0x53, 0xfc, 0x2d, 0x4a, 0x5a, 0x86, 0x37, 0x52, 0xed, 0xc5, 0x2e, 0x5b, 0xfb,
+  0xe5, 0xa6, 0x2e, 0x68, 0xdb, 0x9a, 0x1b, 0xf6, 0xba, 0x14, 0xb4, 0x17, 0xa5, 0x2f, 0x5a, 0x5c,
+  0xd6, 0xf7, 0x0a, 0x42, 0xec, 0xc5, 0x2e, 0x71, 0x4b, 0xf8, 0x45, 0xad, 0x43, 0x6e, 0x69, 0x40,
+  0xdb, 0x4b, 0x97, 0xed, 0x94, 0x98, 0xb9, 0xcd, 0x1b, 0x28, 0x7f, 0xbd, 0x2d, 0x68, 0x3b, 0xa5,
+  0x1f, 0x7a, 0x97, 0x35, 0xfd, 0xc2, 0x90, 0xbb, 0x71, 0x4b, 0x9a, 0x57, 0xf6, 0x5a, 0x16, 0xb5,
+  0x0d, 0xb9, 0xa5, 0x03, 0x6d, 0x2e, 0x5e, 0x5f, 0x7c, 0xa4, 0xc5, 0xce, 0x69, 0x76, 0x52, 0x6b,
+  0xda, 0x6a, 0x52, 0xd0, 0x5c, 0xe2, 0x8c, 0x6e, 0xa1, 0xcb, 0x9f, 0xdd, 0x2d, 0x0b, 0xb7, 0x14,
+  0xb9, 0xcd, 0x2e, 0x6f, 0x67, 0xee, 0x94, 0xb5, 0x0d, 0x99, 0xa5, 0xe9, 0x4a, 0xdc, 0x9e, 0xf1,
+  0x69, 0xdc, 0xc1, 0x23, 0x9a, 0x92, 0x31, 0x5d, 0x74, 0x3f, 0x8a, 0xee, 0x7c, 0x83, 0xd8, 0x57,
+  0x14, 0xc5, 0x1c, 0xd2, 0xc4, 0xff, 0x00, 0x15, 0x58, 0xa8, 0xec, 0x4e, 0xa3, 0x8a, 0x8d, 0xc7,
+  0x35, 0xb6, 0x27, 0xf8, 0x6a, 0xc5, 0x47, 0x71, 0x63, 0x15, 0x2b, 0x0e, 0x28, 0xa1, 0xfc, 0x26,
+  0x53, 0xdc, 0x87, 0x1c, 0xd4, 0xc8, 0x38, 0xac, 0x30, 0xbf, 0x1b, 0xb9, 0x6f, 0x61, 0x1c, 0x52,
+  0x20, 0xe6, 0xa2, 0xaf, 0xf1, 0x8b, 0x5b, 0x13, 0x63, 0x8a, 0x89, 0x87, 0x35, 0xae, 0x2f, 0xe1,
+  0x56, 0x2a, 0x23, 0xe3, 0x14, 0xf6, 0x1c, 0x55, 0x43, 0xf8, 0x25, 0x75, 0x23, 0x03, 0x9a, 0x99,
+  0x47, 0x15, 0x8e, 0x13, 0x77, 0x72, 0xd8, 0xc7, 0x14, 0xa8, 0x39, 0xac, 0x9f, 0xf1, 0x8b, 0x5b,
+  0x12, 0x91, 0xc5, 0x44, 0x47, 0x35, 0xa6, 0x33, 0xa5, 0x8a, 0x81, 0x2a, 0x0a, 0x1c, 0x56, 0x8f,
+  0xf8, 0x03, 0x5b, 0x8c, 0x51, 0xcd, 0x4e, 0x07, 0x15, 0x96, 0x0f, 0x67, 0x72, 0xd9, 0x13, 0x8e,
+  0x69, 0xf1, 0x8a, 0xc6, 0x1f, 0xc6, 0x34, 0xe8, 0x3d, 0x87, 0x15, 0x16, 0x39, 0xaa, 0xc5, 0xfc,
+  0x4a, 0xc5, 0x44, 0x9d, 0x07, 0x14, 0xd7, 0x15, 0xb5, 0x5f, 0xe0, 0x8d, 0x6e, 0x22, 0x0e, 0x6a,
+  0x6c, 0x71, 0x51, 0x85, 0xf8, 0x1d, 0xcb, 0x7b, 0x91, 0x30, 0xe6, 0xa4, 0x8c, 0x56, 0x14, 0x7f,
+  0x8a, 0x5f, 0x41, 0xce, 0x38, 0xa8, 0xc0, 0xe6, 0x8c, 0x4f, 0xf1, 0x15, 0x8a, 0x8e, 0xc4, 0xca,
+  0x38, 0xa6, 0x38, 0xad, 0x71, 0x1f, 0xc2, 0x56, 0x2a, 0x3b, 0x9f, 0xff, 0xd9
+};
+
+#endif
@@ -161,6 +161,8 @@ void setup() {
   RTSPSetver.setStreamSuffix("mjpeg/1");
   RTSPSetver.setFrameRate(FRAMERATE_20HZ); /* 20Hz for 800x600 or lower (RTSP OVER UDP) */
   //RTSPSetver.setAuthAccount("Easy", "RTSPServer"); /* Uncomment the line to enable basic authentication*/
+  //RTSPSetver.setMulticast("239.255.0.1", 5004); /* Uncomment the line to enable RTP multicast*/
+  //RTSPSetver.setAdaptiveQuality(); /* Uncomment the line to adapt jpeg quality and frame rate to the network*/
   RTSPSetver.init(&cam);
 }
 
@@ -0,0 +1,150 @@
+#include "Arduino.h"
+#include "WiFi.h"
+#include "FS.h"
+#include "base64.h"
+#include "esp_timer.h"
+#include <stdarg.h>
+#include <time.h>
+#include <random>
+#include <arpa/inet.h>
+#include <sys/stat.h>
+
+HardwareSerial Serial;
+WiFiClass WiFi;
+
+int64_t esp_timer_get_time() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+uint32_t millis() {
+  return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+uint32_t micros() {
+  return (uint32_t)esp_timer_get_time();
+}
+
+void delay(uint32_t ms) {
+  vTaskDelay(pdMS_TO_TICKS(ms));
+}
+
+uint32_t esp_random() {
+  static thread_local std::mt19937 rng{ std::random_device{}() };
+  return rng();
+}
+
+bool psramFound() {
+  return false;
+}
+
+void* ps_malloc(size_t size) {
+  return malloc(size);
+}
+
+size_t HardwareSerial::print(const char* text) {
+  return fputs(text, stdout) < 0 ? 0 : strlen(text);
+}
+
+size_t HardwareSerial::println(const char* text) {
+  return print(text) + print("\n");
+}
+
+size_t HardwareSerial::printf(const char* format, ...) {
+  va_list args;
+  va_start(args, format);
+  int n = vprintf(format, args);
+  va_end(args);
+  return n < 0 ? 0 : n;
+}
+
+size_t HardwareSerial::write(const uint8_t* data, size_t len) {
+  return fwrite(data, 1, len, stdout);
+}
+
+IPAddress::IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) {
+  uint8_t* bytes = (uint8_t*)&m_addr;
+  bytes[0] = a;
+  bytes[1] = b;
+  bytes[2] = c;
+  bytes[3] = d;
+}
+
+bool IPAddress::fromString(const char* address) {
+  struct in_addr addr;
+  if (inet_pton(AF_INET, address, &addr) != 1) {
+    return false;
+  }
+  m_addr = addr.s_addr;
+  return true;
+}
+
+String IPAddress::toString() const {
+  char text[INET_ADDRSTRLEN];
+  struct in_addr addr = { m_addr };
+  inet_ntop(AF_INET, &addr, text, sizeof(text));
+  return String(text);
+}
+
+String base64::encode(const uint8_t* data, size_t length) {
+  static const char digits[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  std::string out;
+  for (size_t i = 0; i < length; i += 3) {
+    uint32_t n = (uint32_t)data[i] << 16;
+    if (i + 1 < length) {
+      n |= (uint32_t)data[i + 1] << 8;
+    }
+    if (i + 2 < length) {
+      n |= data[i + 2];
+    }
+    out += digits[(n >> 18) & 0x3f];
+    out += digits[(n >> 12) & 0x3f];
+    out += i + 1 < length ? digits[(n >> 6) & 0x3f] : '=';
+    out += i + 2 < length ? digits[n & 0x3f] : '=';
+  }
+  return String(out);
+}
+
+namespace fs {
+
+size_t File::read(uint8_t* buf, size_t size) {
+  return m_file ? fread(buf, 1, size, m_file.get()) : 0;
+}
+
+int File::read() {
+  return m_file ? fgetc(m_file.get()) : -1;
+}
+
+bool File::seek(uint32_t pos) {
+  return m_file && fseek(m_file.get(), pos, SEEK_SET) == 0;
+}
+
+size_t File::position() const {
+  return m_file ? ftell(m_file.get()) : 0;
+}
+
+size_t File::size() const {
+  struct stat st;
+  return m_file && fstat(fileno(m_file.get()), &st) == 0 ? st.st_size : 0;
+}
+
+int File::available() {
+  return size() - position();
+}
+
+File FS::open(const char* path, const char* mode) {
+  std::string full = m_root.empty() ? path : m_root + (path[0] == '/' ? "" : "/") + path;
+  std::string fmode = mode;
+  if (fmode.find('b') == std::string::npos) {
+    fmode += 'b';
+  }
+  FILE* file = fopen(full.c_str(), fmode.c_str());
+  return file ? File(file) : File();
+}
+
+bool FS::exists(const char* path) {
+  return (bool)open(path);
+}
+
+}  // namespace fs
@@ -0,0 +1,61 @@
+#ifndef HOST_ARDUINO_H_
+#define HOST_ARDUINO_H_
+
+// Just enough of the Arduino-ESP32 core for the library to build and run on Linux.
+// Time, tasks and sockets are the host's own, there is no camera and no WiFi.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <ctype.h>
+#include <time.h>
+#include <algorithm>
+#include <string>
+#include "esp_err.h"
+#include "esp32-hal-log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+using std::max;
+using std::min;
+
+typedef bool boolean;
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+uint32_t esp_random();
+
+// no PSRAM, the heap is the heap
+bool psramFound();
+void* ps_malloc(size_t size);
+
+#define F(x) x
+
+class String {
+public:
+  String(const char* s = "") : m_str(s ? s : "") {}
+  String(const std::string& s) : m_str(s) {}
+  const char* c_str() const { return m_str.c_str(); }
+  unsigned length() const { return m_str.length(); }
+private:
+  std::string m_str;
+};
+
+// stdout
+class HardwareSerial {
+public:
+  void begin(unsigned long baud) {}
+  operator bool() { return true; }
+  size_t print(const char* text);
+  size_t println(const char* text = "");
+  size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+  size_t write(const uint8_t* data, size_t len);
+};
+
+extern HardwareSerial Serial;
+
+#endif
@@ -0,0 +1,42 @@
+#ifndef HOST_FS_H_
+#define HOST_FS_H_
+
+#include "Arduino.h"
+#include <memory>
+
+namespace fs {
+
+// Copies share the open file like Arduino's File does
+class File {
+public:
+  File() {}
+  explicit File(FILE* file) : m_file(file, fclose) {}
+  size_t read(uint8_t* buf, size_t size);
+  int read();
+  bool seek(uint32_t pos);
+  size_t position() const;
+  size_t size() const;
+  int available();
+  void close() { m_file.reset(); }
+  operator bool() const { return m_file != nullptr; }
+private:
+  std::shared_ptr<FILE> m_file;
+};
+
+// A directory of the host standing in for a mounted file system, paths are
+// taken as they are without one
+class FS {
+public:
+  explicit FS(const char* root = "") : m_root(root) {}
+  File open(const char* path, const char* mode = "r");
+  bool exists(const char* path);
+private:
+  std::string m_root;
+};
+
+}  // namespace fs
+
+using fs::File;
+using fs::FS;
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef HOST_WIFI_H_
+#define HOST_WIFI_H_
+
+#include "Arduino.h"
+
+// IPv4 address, the bytes in network order like lwIP keeps them
+class IPAddress {
+public:
+  IPAddress() : m_addr(0) {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d);
+  IPAddress(uint32_t addr) : m_addr(addr) {}  // as in sin_addr.s_addr
+  operator uint32_t() const { return m_addr; }
+  uint8_t operator[](int index) const { return ((const uint8_t*)&m_addr)[index]; }
+  bool operator==(const IPAddress& other) const { return m_addr == other.m_addr; }
+  bool fromString(const char* address);
+  String toString() const;
+private:
+  uint32_t m_addr;
+};
+
+// The server announces this address in its SDP, loopback unless set otherwise
+class WiFiClass {
+public:
+  IPAddress localIP() { return m_localIP; }
+  void setLocalIP(IPAddress ip) { m_localIP = ip; }
+private:
+  IPAddress m_localIP{ 127, 0, 0, 1 };
+};
+
+extern WiFiClass WiFi;
+
+#endif
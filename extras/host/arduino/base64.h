@@ -0,0 +1,11 @@
+#ifndef HOST_BASE64_H_
+#define HOST_BASE64_H_
+
+#include "Arduino.h"
+
+class base64 {
+public:
+  static String encode(const uint8_t* data, size_t length);
+};
+
+#endif
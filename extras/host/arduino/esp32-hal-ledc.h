@@ -0,0 +1 @@
+// LED PWM of the camera clock, unused on the host
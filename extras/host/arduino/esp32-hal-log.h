@@ -0,0 +1,18 @@
+#ifndef HOST_ESP32_HAL_LOG_H_
+#define HOST_ESP32_HAL_LOG_H_
+
+#include <stdio.h>
+
+// errors and warnings of the core to stderr, info stays quiet
+#define ARDUHAL_LOG_LEVEL_ERROR 1
+#define ARDUHAL_LOG_LEVEL_WARN 2
+#define ARDUHAL_LOG_LEVEL_INFO 3
+#define ARDUHAL_LOG_LEVEL ARDUHAL_LOG_LEVEL_WARN
+
+#define log_e(format, ...) fprintf(stderr, "[E] " format "\n", ##__VA_ARGS__)
+#define log_w(format, ...) fprintf(stderr, "[W] " format "\n", ##__VA_ARGS__)
+#define log_i(format, ...) \
+  do { \
+  } while (0)
+
+#endif
@@ -0,0 +1,29 @@
+#include "esp_camera.h"
+#include "img_converters.h"
+
+esp_err_t esp_camera_init(const camera_config_t* config) {
+  return ESP_ERR_NOT_SUPPORTED;
+}
+
+camera_fb_t* esp_camera_fb_get() {
+  return NULL;
+}
+
+void esp_camera_fb_return(camera_fb_t* fb) {
+}
+
+sensor_t* esp_camera_sensor_get() {
+  return NULL;
+}
+
+bool frame2jpg(camera_fb_t* fb, uint8_t quality, uint8_t** out, size_t* outLen) {
+  return false;
+}
+
+bool fmt2jpg(uint8_t* src, size_t srcLen, uint16_t width, uint16_t height, pixformat_t format, uint8_t quality, uint8_t** out, size_t* outLen) {
+  return false;
+}
+
+bool fmt2rgb888(const uint8_t* src, size_t srcLen, pixformat_t format, uint8_t* rgb) {
+  return false;
+}
@@ -0,0 +1 @@
+// the camera frame drawing helpers, unused on the host
@@ -0,0 +1,71 @@
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+struct HostTask {
+  std::mutex lock;
+  std::condition_variable notified;
+  uint32_t count = 0;
+};
+
+// Handles live as long as the process, like tasks that never end on the target
+static thread_local HostTask* s_currentTask = NULL;
+
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+  if (!s_currentTask) {
+    s_currentTask = new HostTask();
+  }
+  return s_currentTask;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t code, const char* name, uint32_t stackDepth, void* param, UBaseType_t priority, TaskHandle_t* created) {
+  return xTaskCreatePinnedToCore(code, name, stackDepth, param, priority, created, tskNO_AFFINITY);
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t code, const char* name, uint32_t stackDepth, void* param, UBaseType_t priority, TaskHandle_t* created, BaseType_t core) {
+  HostTask* task = new HostTask();
+  if (created) {
+    *created = task;
+  }
+  std::thread([=]() {
+    s_currentTask = task;
+    code(param);
+  }).detach();
+  return pdPASS;
+}
+
+void vTaskDelay(TickType_t ticks) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ticks * portTICK_PERIOD_MS));
+}
+
+void taskYIELD() {
+  std::this_thread::yield();
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticksToWait) {
+  HostTask* task = xTaskGetCurrentTaskHandle();
+  std::unique_lock<std::mutex> guard(task->lock);
+  auto pending = [task]() { return task->count > 0; };
+  if (ticksToWait == portMAX_DELAY) {
+    task->notified.wait(guard, pending);
+  } else {
+    task->notified.wait_for(guard, std::chrono::milliseconds(ticksToWait * portTICK_PERIOD_MS), pending);
+  }
+  uint32_t count = task->count;
+  if (count > 0) {
+    task->count = clearOnExit ? 0 : count - 1;
+  }
+  return count;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+  {
+    std::lock_guard<std::mutex> guard(task->lock);
+    task->count++;
+  }
+  task->notified.notify_one();
+  return pdPASS;
+}
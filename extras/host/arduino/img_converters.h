@@ -0,0 +1,11 @@
+#ifndef HOST_IMG_CONVERTERS_H_
+#define HOST_IMG_CONVERTERS_H_
+
+#include "esp_camera.h"
+
+// Frames always arrive as JPEG on the host, the converters only report failure
+bool frame2jpg(camera_fb_t* fb, uint8_t quality, uint8_t** out, size_t* outLen);
+bool fmt2jpg(uint8_t* src, size_t srcLen, uint16_t width, uint16_t height, pixformat_t format, uint8_t quality, uint8_t** out, size_t* outLen);
+bool fmt2rgb888(const uint8_t* src, size_t srcLen, pixformat_t format, uint8_t* rgb);
+
+#endif
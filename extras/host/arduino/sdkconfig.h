@@ -0,0 +1 @@
+// no ESP-IDF configuration on the host, face detection and recognition stay off
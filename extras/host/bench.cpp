@@ -0,0 +1,349 @@
+#include "EasyRTSPServer.h"
+#include "esp_timer.h"
+#include <dirent.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+//
+// The hot paths of the library on Linux, built from the same sources as the firmware:
+//   - decodeJPEGfile() over the frames                          -> ns/frame
+//   - the 0xff scan of the entropy data, byte by byte and with findFF() of jpeg.cpp -> ns/frame
+//   - RTPFrame::packFrame() + buildHeader() for UDP and TCP     -> ns/frame, ns/packet
+//   - UDP sends over loopback, one sendmsg() per packet and UDPSocket::sendBatch() -> ns/packet
+//   - whole RTSP sessions over a socketpair, every request through RTSPSession::run()
+//     and Handle_RtspRequest() with the reply read back        -> ns/request
+//
+//   bench [directory of .jpg frames] [rounds]
+//
+// examples/Benchmark runs the same measurements on the board.
+//
+
+#define BENCH_FRAMES_DIR "frames"
+#define BENCH_ROUNDS 200
+#define BENCH_UDP_PORT 50000
+
+struct Frame {
+  std::string name;
+  std::vector<uint8_t> data;
+  JpegInfo info;
+};
+
+static std::vector<Frame> frames;
+static uint32_t totalBytes = 0;
+static int rounds = BENCH_ROUNDS;
+
+// Serves the frame size of the recordings, the sessions never play
+class BenchSource : public FrameSource {
+public:
+  bool capture(CamFrame* frame) override { return false; }
+  void release(CamFrame* frame) override {}
+  int getWidth() override { return frames[0].info.width; }
+  int getHeight() override { return frames[0].info.height; }
+};
+
+static bool loadFrames(const char* dir) {
+  DIR* d = opendir(dir);
+  if (!d) {
+    printf("can't open %s\n", dir);
+    return false;
+  }
+  std::vector<std::string> names;
+  while (struct dirent* entry = readdir(d)) {
+    std::string name = entry->d_name;
+    if (name.size() > 4 && name.compare(name.size() - 4, 4, ".jpg") == 0) {
+      names.push_back(name);
+    }
+  }
+  closedir(d);
+  std::sort(names.begin(), names.end());
+
+  for (const std::string& name : names) {
+    FILE* f = fopen((std::string(dir) + "/" + name).c_str(), "rb");
+    if (!f) {
+      continue;
+    }
+    Frame frame;
+    frame.name = name;
+    uint8_t chunk[4096];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) {
+      frame.data.insert(frame.data.end(), chunk, chunk + n);
+    }
+    fclose(f);
+    if (!decodeJPEGfile(frame.data.data(), frame.data.size(), &frame.info)) {
+      printf("%s: not a frame RFC 2435 can carry, skipped\n", name.c_str());
+      continue;
+    }
+    printf("%-24s %4ux%-4u %s %6u bytes%s\n", name.c_str(), frame.info.width, frame.info.height,
+           frame.info.type ? "4:2:0" : "4:2:2", (unsigned)frame.data.size(), frame.info.restartInterval ? "  restart markers" : "");
+    totalBytes += frame.data.size();
+    frames.push_back(std::move(frame));
+  }
+  return !frames.empty();
+}
+
+static void benchJpeg() {
+  JpegInfo info;
+  int valid = 0;
+  int64_t start = esp_timer_get_time();
+  for (int r = 0; r < rounds; r++) {
+    for (const Frame& frame : frames) {
+      valid += decodeJPEGfile(frame.data.data(), frame.data.size(), &info);
+    }
+  }
+  int64_t usec = esp_timer_get_time() - start;
+  int n = rounds * frames.size();
+  printf("decodeJPEGfile:  %8u ns/frame  %7.1f MB/s  (%d/%d valid)\n",
+         (unsigned)(usec * 1000 / n), (double)totalBytes * rounds / usec, valid, n);
+}
+
+// byte by byte, how the scan for markers worked before
+static uint32_t findFFBytes(BufPtr p, uint32_t i, uint32_t len) {
+  while (i < len && p[i] != 0xff) {
+    i++;
+  }
+  return i;
+}
+
+static void benchFindFF(const char* name, uint32_t (*scanner)(BufPtr, uint32_t, uint32_t)) {
+  uint32_t found = 0;
+  uint64_t bytes = 0;
+  int64_t start = esp_timer_get_time();
+  for (int r = 0; r < rounds; r++) {
+    for (const Frame& frame : frames) {
+      BufPtr scan = frame.info.scan;
+      uint32_t len = frame.info.scanLen;
+      for (uint32_t pos = scanner(scan, 0, len); pos < len; pos = scanner(scan, pos + 1, len)) {
+        found++;
+      }
+      bytes += len;
+    }
+  }
+  int64_t usec = esp_timer_get_time() - start;
+  int n = rounds * frames.size();
+  printf("findFF %-6s    %8u ns/frame  %7.1f MB/s  (%u 0xff/frame)\n",
+         name, (unsigned)(usec * 1000 / n), (double)bytes / usec, found / n);
+}
+
+static void benchPacketize(const char* name, int packetSize) {
+  static RTPFrame rtp;
+  static char header[KRtpMaxHeaderSize];
+
+  uint32_t packets = 0;
+  uint16_t seq = 0;
+  int64_t start = esp_timer_get_time();
+  for (int r = 0; r < rounds; r++) {
+    for (const Frame& frame : frames) {
+      if (!rtp.packFrame(frame.info)) {
+        continue;
+      }
+      for (uint32_t offset = 0; offset < rtp.getLength();) {
+        BufPtr payload;
+        int payloadLen;
+        rtp.buildHeader(&offset, packetSize, seq++, 0, 0x12345678, header, &payload, &payloadLen);
+        packets++;
+      }
+    }
+  }
+  int64_t usec = esp_timer_get_time() - start;
+  int n = rounds * frames.size();
+  printf("packetize %-6s %8u ns/frame  %5u ns/packet  %4u packets/frame\n",
+         name, (unsigned)(usec * 1000 / n), (unsigned)(usec * 1000 / packets), packets / n);
+}
+
+static int sendPackets(UDPSocket* socket, const RTPPacket* batch, int count, IPAddress ip, bool batched) {
+  if (batched) {
+    uint32_t bytes;
+    return socket->sendBatch(batch, count, ip, BENCH_UDP_PORT, &bytes);
+  }
+  int failed = 0;
+  for (int i = 0; i < count; i++) {
+    struct iovec iov[2] = {
+      { batch[i].header + KRtpPrefixSize, (size_t)(batch[i].headerLen - KRtpPrefixSize) },
+      { (void*)batch[i].payload, (size_t)batch[i].payloadLen }
+    };
+    if (socket->sendv(iov, 2, ip, BENCH_UDP_PORT) < 0) {
+      failed++;
+    }
+  }
+  return failed;
+}
+
+// one sendmsg() per packet against UDPSocket::sendBatch(), sendmmsg() or a GSO send here
+static void benchSend(bool batched) {
+  static RTPFrame rtp;
+  static char headers[RTP_MAX_BATCH][KRtpMaxHeaderSize];
+  static uint8_t sinkBuf[65536];
+  RTPPacket batch[RTP_MAX_BATCH];
+  UDPSocket sink, socket;
+  if (!sink.begin(BENCH_UDP_PORT) || !socket.begin(BENCH_UDP_PORT + 2)) {
+    printf("send: no loopback sockets\n");
+    return;
+  }
+  IPAddress local(127, 0, 0, 1);
+
+  uint32_t packets = 0;
+  uint32_t failed = 0;
+  uint16_t seq = 0;
+  int64_t start = esp_timer_get_time();
+  for (int r = 0; r < rounds; r++) {
+    for (const Frame& frame : frames) {
+      if (!rtp.packFrame(frame.info)) {
+        continue;
+      }
+      int count = 0;
+      for (uint32_t offset = 0; offset < rtp.getLength();) {
+        RTPPacket* packet = &batch[count];
+        packet->header = headers[count];
+        packet->headerLen = rtp.buildHeader(&offset, RTP_UDP_MTU - 28, seq++, 0, 0x12345678, packet->header, &packet->payload, &packet->payloadLen);
+        if (++count == RTP_MAX_BATCH || offset >= rtp.getLength()) {
+          failed += sendPackets(&socket, batch, count, local, batched);
+          packets += count;
+          count = 0;
+        }
+      }
+      while (sink.recv(sinkBuf, sizeof(sinkBuf)) > 0) {
+        ;  // the same for both, a full sink would only drop
+      }
+    }
+  }
+  int64_t usec = esp_timer_get_time() - start;
+  int n = rounds * frames.size();
+  printf("send udp %-7s  %8u ns/frame  %5u ns/packet  (%u failed)\n",
+         batched ? "batched" : "single", (unsigned)(usec * 1000 / n), (unsigned)(usec * 1000 / packets), failed);
+  socket.stop();
+  sink.stop();
+}
+
+// Request sequences as the clients send them, one session each
+static const char* const VLC_SESSION[] = {
+  "OPTIONS rtsp://127.0.0.1:8554/mjpeg/1 RTSP/1.0\r\n"
+  "CSeq: 2\r\n"
+  "User-Agent: LibVLC/3.0.18 (LIVE555 Streaming Media v2016.11.28)\r\n"
+  "\r\n",
+  "DESCRIBE rtsp://127.0.0.1:8554/mjpeg/1 RTSP/1.0\r\n"
+  "CSeq: 3\r\n"
+  "User-Agent: LibVLC/3.0.18 (LIVE555 Streaming Media v2016.11.28)\r\n"
+  "Accept: application/sdp\r\n"
+  "\r\n",
+  "SETUP rtsp://127.0.0.1:8554/mjpeg/1/trackID=1 RTSP/1.0\r\n"
+  "CSeq: 4\r\n"
+  "User-Agent: LibVLC/3.0.18 (LIVE555 Streaming Media v2016.11.28)\r\n"
+  "Transport: RTP/AVP;unicast;client_port=57844-57845\r\n"
+  "\r\n",
+  "PLAY rtsp://127.0.0.1:8554/mjpeg/1 RTSP/1.0\r\n"
+  "CSeq: 5\r\n"
+  "User-Agent: LibVLC/3.0.18 (LIVE555 Streaming Media v2016.11.28)\r\n"
+  "Session: 66334873\r\n"
+  "Range: npt=0.000-\r\n"
+  "\r\n",
+  "GET_PARAMETER rtsp://127.0.0.1:8554/mjpeg/1 RTSP/1.0\r\n"
+  "CSeq: 6\r\n"
+  "User-Agent: LibVLC/3.0.18 (LIVE555 Streaming Media v2016.11.28)\r\n"
+  "Session: 66334873\r\n"
+  "\r\n",
+  "TEARDOWN rtsp://127.0.0.1:8554/mjpeg/1 RTSP/1.0\r\n"
+  "CSeq: 7\r\n"
+  "User-Agent: LibVLC/3.0.18 (LIVE555 Streaming Media v2016.11.28)\r\n"
+  "Session: 66334873\r\n"
+  "\r\n",
+};
+
+static const char* const FFMPEG_SESSION[] = {
+  "OPTIONS rtsp://127.0.0.1:8554/mjpeg/1 RTSP/1.0\r\n"
+  "CSeq: 1\r\n"
+  "User-Agent: Lavf60.3.100\r\n"
+  "\r\n",
+  "DESCRIBE rtsp://127.0.0.1:8554/mjpeg/1 RTSP/1.0\r\n"
+  "Accept: application/sdp\r\n"
+  "CSeq: 2\r\n"
+  "User-Agent: Lavf60.3.100\r\n"
+  "\r\n",
+  "SETUP rtsp://127.0.0.1:8554/mjpeg/1/trackID=1 RTSP/1.0\r\n"
+  "Transport: RTP/AVP/TCP;unicast;interleaved=0-1\r\n"
+  "CSeq: 3\r\n"
+  "User-Agent: Lavf60.3.100\r\n"
+  "\r\n",
+  "PLAY rtsp://127.0.0.1:8554/mjpeg/1 RTSP/1.0\r\n"
+  "Range: npt=0.000-\r\n"
+  "CSeq: 4\r\n"
+  "User-Agent: Lavf60.3.100\r\n"
+  "Session: 66334873\r\n"
+  "\r\n",
+  "TEARDOWN rtsp://127.0.0.1:8554/mjpeg/1 RTSP/1.0\r\n"
+  "CSeq: 5\r\n"
+  "User-Agent: Lavf60.3.100\r\n"
+  "Session: 66334873\r\n"
+  "\r\n",
+};
+
+// Sessions one after the other on a socketpair, each request is written, handled by
+// RTSPSession::run() the way the reactor calls it when the socket is readable, and
+// its reply read back before the next one.
+static void benchSession(EasyRTSPServer* server, const char* name, const char* const* requests, int count) {
+  static RTSPSession session;
+  char reply[4096];
+  uint32_t handled = 0;
+  uint32_t failed = 0;
+  int64_t start = esp_timer_get_time();
+  for (int r = 0; r < rounds; r++) {
+    int fds[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) < 0) {
+      printf("session: no socketpair: %d\n", errno);
+      return;
+    }
+    session.open(fds[0], server);
+    session.setIndex(0);
+    for (int i = 0; i < count; i++) {
+      size_t len = strlen(requests[i]);
+      if (write(fds[1], requests[i], len) != (ssize_t)len) {
+        failed++;
+        break;
+      }
+      session.run();
+      if (session.Status() >= SessionStatus::STATUS_CLOSED) {
+        session.close();  // sends the TEARDOWN reply, like the reactor does
+      }
+      ssize_t n = recv(fds[1], reply, sizeof(reply) - 1, MSG_DONTWAIT);
+      if (n < 12 || strncmp(reply, "RTSP/1.0 200", 12) != 0) {
+        failed++;
+      }
+      handled++;
+    }
+    session.close();
+    close(fds[1]);
+  }
+  int64_t usec = esp_timer_get_time() - start;
+  printf("session %-8s %8u ns/request  %u requests  (%u failed)\n",
+         name, (unsigned)(usec * 1000 / handled), handled, failed);
+}
+
+int main(int argc, char** argv) {
+  const char* dir = argc > 1 ? argv[1] : BENCH_FRAMES_DIR;
+  if (argc > 2) {
+    rounds = max(1, atoi(argv[2]));
+  }
+  if (!loadFrames(dir)) {
+    printf("no frames in %s\n", dir);
+    return 1;
+  }
+  printf("%u frames, %u bytes on average, %d rounds\n", (unsigned)frames.size(), totalBytes / (unsigned)frames.size(), rounds);
+
+  benchJpeg();
+  benchFindFF("bytes", findFFBytes);
+  benchFindFF("lib", findFF);
+  benchPacketize("udp", RTP_UDP_MTU - 28);
+  benchPacketize("tcp", RTP_TCP_PACKET_SIZE);
+  benchSend(false);
+  benchSend(true);
+
+  static BenchSource source;
+  static EasyRTSPServer server(8554);
+  server.setStreamSuffix("mjpeg/1");
+  server.setMaxClients(1);
+  server.init(&source);
+  benchSession(&server, "vlc", VLC_SESSION, sizeof(VLC_SESSION) / sizeof(VLC_SESSION[0]));
+  benchSession(&server, "ffmpeg", FFMPEG_SESSION, sizeof(FFMPEG_SESSION) / sizeof(FFMPEG_SESSION[0]));
+  return 0;
+}
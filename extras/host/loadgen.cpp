@@ -0,0 +1,462 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+#include <errno.h>
+#include <unistd.h>
+#include <getopt.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <algorithm>
+#include <vector>
+
+//
+// A swarm of simulated RTSP clients to find the capacity of a server, a host program
+// with plain POSIX sockets so the clients never compete with the server for a CPU.
+// Each client runs OPTIONS, DESCRIBE, SETUP and PLAY, then receives RTP over UDP
+// (even clients) or interleaved TCP (odd clients) and reassembles the RFC 2435
+// fragments of every frame. Every report interval it prints per client:
+//   fps       complete frames per second
+//   complete  share of frames whose fragments all arrived, in order
+//   jitter    RFC 3550 interarrival jitter of the frames, against their RTP timestamps
+//   ctrl      RTSP response latency, average and worst
+//
+//   loadgen [-n clients] [-t seconds] [-r report ms] rtsp://host[:port]/path
+//
+// Against server on the same machine every run sees the same frames, against a board
+// it measures the real thing. With -t it stops after that many seconds and exits with
+// 1 unless every client streamed complete frames.
+//
+
+#define LOAD_CLIENTS 4
+#define LOAD_REPORT_MS 5000
+#define LOAD_TCP_RX_SIZE (4 + 65535 + 1024)  // the largest interleaved packet, with room for an RTSP reply
+#define LOAD_UDP_RX_SIZE 2048                // RTSP replies only
+
+enum ClientState {
+  CLIENT_OPTIONS,
+  CLIENT_DESCRIBE,
+  CLIENT_SETUP,
+  CLIENT_PLAY,
+  CLIENT_STREAMING,
+  CLIENT_FAILED
+};
+
+struct LoadClient {
+  int index;
+  bool tcp;
+  int ctrlFd = -1;
+  int rtpFd = -1;
+  uint16_t rtpPort = 0;
+  ClientState state;
+  unsigned cseq = 0;
+  char session[32] = { 0 };
+  char* rx = NULL;  // RTSP responses and interleaved RTP
+  int rxSize = 0;
+  int rxLen = 0;
+  uint8_t rtp[65536];
+
+  // control plane
+  int64_t requestUsec;
+  uint32_t ctrlCount = 0;
+  uint32_t ctrlSumUsec = 0;
+  uint32_t ctrlMaxUsec = 0;
+
+  // reassembly of the frame being received
+  bool inFrame = false;
+  uint32_t frameTs;
+  uint32_t expectOffset;
+  bool frameOk;
+
+  // frames
+  uint32_t complete = 0;
+  uint32_t incomplete = 0;
+  uint32_t reportComplete = 0;  // at the last report
+  uint32_t reportIncomplete = 0;
+  int64_t lastArrivalUsec = 0;
+  uint32_t lastTs = 0;
+  double jitterUsec = 0;
+};
+
+static std::vector<LoadClient*> clients;
+static char url[256];
+static struct sockaddr_in serverAddr;
+
+static int64_t nowUsec() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static uint32_t get24(const uint8_t* p) {
+  return ((uint32_t)p[0] << 16) | ((uint32_t)p[1] << 8) | p[2];
+}
+
+static uint32_t get32(const uint8_t* p) {
+  return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static void sendRequest(LoadClient* c, const char* method, const char* target, const char* extra) {
+  char req[512];
+  int l = snprintf(req, sizeof(req), "%s %s RTSP/1.0\r\nCSeq: %u\r\nUser-Agent: EasyRTSPLoad\r\n%s%s%s%s\r\n",
+                   method, target, ++c->cseq,
+                   c->session[0] ? "Session: " : "", c->session, c->session[0] ? "\r\n" : "",
+                   extra);
+  c->requestUsec = nowUsec();
+  if (send(c->ctrlFd, req, l, MSG_NOSIGNAL) != l) {
+    c->state = CLIENT_FAILED;
+  }
+}
+
+static void nextRequest(LoadClient* c) {
+  char target[300];
+  char transport[96];
+  switch (c->state) {
+    case CLIENT_OPTIONS:
+      sendRequest(c, "OPTIONS", url, "");
+      break;
+    case CLIENT_DESCRIBE:
+      sendRequest(c, "DESCRIBE", url, "Accept: application/sdp\r\n");
+      break;
+    case CLIENT_SETUP:
+      snprintf(target, sizeof(target), "%s/trackID=1", url);
+      if (c->tcp) {
+        snprintf(transport, sizeof(transport), "Transport: RTP/AVP/TCP;unicast;interleaved=0-1\r\n");
+      } else {
+        snprintf(transport, sizeof(transport), "Transport: RTP/AVP;unicast;client_port=%d-%d\r\n", c->rtpPort, c->rtpPort + 1);
+      }
+      sendRequest(c, "SETUP", target, transport);
+      break;
+    case CLIENT_PLAY:
+      sendRequest(c, "PLAY", url, "Range: npt=0.000-\r\n");
+      break;
+    default:
+      break;
+  }
+}
+
+static bool openClient(LoadClient* c, int index) {
+  c->index = index;
+  c->tcp = index % 2 == 1;
+  c->state = CLIENT_OPTIONS;
+  c->rxSize = c->tcp ? LOAD_TCP_RX_SIZE : LOAD_UDP_RX_SIZE;
+  c->rx = (char*)malloc(c->rxSize);
+  if (!c->rx) {
+    printf("client %d: no memory for %d bytes\n", index, c->rxSize);
+    return false;
+  }
+
+  c->ctrlFd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+  if (c->ctrlFd < 0 || connect(c->ctrlFd, (struct sockaddr*)&serverAddr, sizeof(serverAddr)) < 0) {
+    printf("client %d: can't connect: %s\n", index, strerror(errno));
+    return false;
+  }
+  int rcvbuf = 256 * 1024;
+  setsockopt(c->ctrlFd, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+
+  if (!c->tcp) {
+    // any free port, so the number of clients isn't bound to a port range
+    struct sockaddr_in addr;
+    socklen_t addrLen = sizeof(addr);
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = 0;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    c->rtpFd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (c->rtpFd < 0 || bind(c->rtpFd, (struct sockaddr*)&addr, sizeof(addr)) < 0
+        || getsockname(c->rtpFd, (struct sockaddr*)&addr, &addrLen) < 0) {
+      printf("client %d: can't bind udp: %s\n", index, strerror(errno));
+      return false;
+    }
+    c->rtpPort = ntohs(addr.sin_port);
+    setsockopt(c->rtpFd, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+  }
+  nextRequest(c);
+  return true;
+}
+
+// One RTP packet of RFC 2435 JPEG. A frame is complete when its fragment offsets
+// follow each other without a gap up to the packet with the marker bit.
+static void handleRtp(LoadClient* c, const uint8_t* p, int len) {
+  if (len < 12 + 8 || (p[0] >> 6) != 2) {
+    return;
+  }
+  int hdr = 12 + 4 * (p[0] & 0x0f);
+  if (len < hdr + 8) {
+    return;
+  }
+  bool marker = p[1] & 0x80;
+  uint32_t ts = get32(p + 4);
+  const uint8_t* jpeg = p + hdr;
+  uint32_t offset = get24(jpeg + 1);
+  uint8_t type = jpeg[4];
+  uint8_t q = jpeg[5];
+  int payload = hdr + 8;
+  if (type >= 64) {
+    payload += 4;  // restart marker header
+  }
+  if (q >= 128 && offset == 0 && len >= payload + 4) {
+    payload += 4 + ((p[payload + 2] << 8) | p[payload + 3]);  // quant table header
+  }
+  if (payload > len) {
+    return;
+  }
+
+  if (!c->inFrame || ts != c->frameTs) {
+    if (c->inFrame) {
+      c->incomplete++;  // the marker of the previous frame never came
+    }
+    c->inFrame = true;
+    c->frameTs = ts;
+    c->expectOffset = 0;
+    c->frameOk = true;
+  }
+  if (offset != c->expectOffset) {
+    c->frameOk = false;
+  }
+  c->expectOffset = offset + (len - payload);
+
+  if (marker) {
+    c->inFrame = false;
+    if (!c->frameOk) {
+      c->incomplete++;
+      return;
+    }
+    c->complete++;
+    int64_t now = nowUsec();
+    if (c->lastArrivalUsec) {
+      double d = (double)(now - c->lastArrivalUsec) - (double)(uint32_t)(ts - c->lastTs) * 1000.0 / 90.0;
+      c->jitterUsec += (fabs(d) - c->jitterUsec) / 16;
+    }
+    c->lastArrivalUsec = now;
+    c->lastTs = ts;
+  }
+}
+
+// RTSP responses, and RTP interleaved with them once TCP clients stream
+static void handleControl(LoadClient* c) {
+  int n = recv(c->ctrlFd, c->rx + c->rxLen, c->rxSize - 1 - c->rxLen, MSG_DONTWAIT);
+  if (n == 0 || (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) {
+    printf("client %d: connection closed\n", c->index);
+    c->state = CLIENT_FAILED;
+    return;
+  }
+  if (n > 0) {
+    c->rxLen += n;
+  }
+
+  while (c->rxLen > 0) {
+    int used;
+    if (c->rx[0] == '$') {
+      if (c->rxLen < 4) {
+        break;
+      }
+      int len = ((uint8_t)c->rx[2] << 8) | (uint8_t)c->rx[3];
+      if (c->rxLen < 4 + len) {
+        break;
+      }
+      if (c->rx[1] == 0) {
+        handleRtp(c, (const uint8_t*)c->rx + 4, len);
+      }
+      used = 4 + len;
+    } else {
+      c->rx[c->rxLen] = 0;
+      char* end = strstr(c->rx, "\r\n\r\n");
+      if (!end) {
+        if (c->rxLen == c->rxSize - 1) {
+          printf("client %d: response too long\n", c->index);
+          c->state = CLIENT_FAILED;
+        }
+        return;
+      }
+      used = end + 4 - c->rx;
+      char* cl = strstr(c->rx, "Content-Length:");
+      if (cl && cl < end) {
+        used += atoi(cl + 15);
+        if (c->rxLen < used) {
+          break;
+        }
+      }
+
+      uint32_t latency = nowUsec() - c->requestUsec;
+      c->ctrlCount++;
+      c->ctrlSumUsec += latency;
+      if (latency > c->ctrlMaxUsec) {
+        c->ctrlMaxUsec = latency;
+      }
+      if (strncmp(c->rx, "RTSP/1.0 200", 12) != 0) {
+        printf("client %d: %.*s\n", c->index, (int)(strstr(c->rx, "\r\n") - c->rx), c->rx);
+        c->state = CLIENT_FAILED;
+        return;
+      }
+      char* session = strstr(c->rx, "Session:");
+      if (session && session < end && !c->session[0]) {
+        session += 8;
+        while (*session == ' ') {
+          session++;
+        }
+        int len = strcspn(session, ";\r\n");
+        snprintf(c->session, sizeof(c->session), "%.*s", len, session);
+      }
+      if (c->state < CLIENT_STREAMING) {
+        c->state = (ClientState)(c->state + 1);
+        nextRequest(c);
+      }
+    }
+    memmove(c->rx, c->rx + used, c->rxLen - used);
+    c->rxLen -= used;
+  }
+}
+
+static void report(uint32_t windowMsec) {
+  uint32_t totalFrames = 0;
+  for (LoadClient* c : clients) {
+    uint32_t complete = c->complete - c->reportComplete;
+    uint32_t incomplete = c->incomplete - c->reportIncomplete;
+    c->reportComplete = c->complete;
+    c->reportIncomplete = c->incomplete;
+    totalFrames += complete;
+    if (c->state == CLIENT_STREAMING && complete + incomplete == 0) {
+      printf("client %d: streaming but no frame reassembled\n", c->index);
+    }
+    printf("client %d %s %-9s frames %6u  fps %5.2f  complete %5.1f%%  jitter %6.2f ms  ctrl %5.2f/%5.2f ms\n",
+           c->index, c->tcp ? "tcp" : "udp", c->state == CLIENT_FAILED ? "failed" : c->state == CLIENT_STREAMING ? "streaming" : "setup",
+           c->complete, complete * 1000.0 / windowMsec,
+           complete + incomplete ? complete * 100.0 / (complete + incomplete) : 0.0,
+           c->jitterUsec / 1000,
+           c->ctrlCount ? c->ctrlSumUsec / 1000.0 / c->ctrlCount : 0.0, c->ctrlMaxUsec / 1000.0);
+  }
+  printf("total %5.2f fps\n", totalFrames * 1000.0 / windowMsec);
+  fflush(stdout);
+}
+
+// rtsp://host[:port]/path
+static bool resolve(const char* rtspUrl) {
+  char host[128];
+  int port = 554;
+  if (strncmp(rtspUrl, "rtsp://", 7) != 0) {
+    return false;
+  }
+  const char* p = rtspUrl + 7;
+  size_t hostLen = strcspn(p, ":/");
+  if (hostLen == 0 || hostLen >= sizeof(host)) {
+    return false;
+  }
+  memcpy(host, p, hostLen);
+  host[hostLen] = 0;
+  if (p[hostLen] == ':') {
+    port = atoi(p + hostLen + 1);
+  }
+  struct addrinfo hints;
+  struct addrinfo* res;
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_STREAM;
+  if (getaddrinfo(host, NULL, &hints, &res) != 0) {
+    return false;
+  }
+  serverAddr = *(struct sockaddr_in*)res->ai_addr;
+  serverAddr.sin_port = htons(port);
+  freeaddrinfo(res);
+  snprintf(url, sizeof(url), "%s", rtspUrl);
+  return true;
+}
+
+static void usage() {
+  printf("usage: loadgen [-n clients] [-t seconds] [-r report ms] rtsp://host[:port]/path\n");
+}
+
+int main(int argc, char** argv) {
+  int count = LOAD_CLIENTS;
+  int seconds = 0;
+  uint32_t reportMsec = LOAD_REPORT_MS;
+  int opt;
+  while ((opt = getopt(argc, argv, "n:t:r:h")) != -1) {
+    switch (opt) {
+      case 'n':
+        count = atoi(optarg);
+        break;
+      case 't':
+        seconds = atoi(optarg);
+        break;
+      case 'r':
+        reportMsec = atoi(optarg);
+        break;
+      default:
+        usage();
+        return 1;
+    }
+  }
+  if (optind != argc - 1 || count < 1 || reportMsec == 0 || !resolve(argv[optind])) {
+    usage();
+    return 1;
+  }
+
+  printf("%d clients against %s\n", count, url);
+  for (int i = 0; i < count; i++) {
+    LoadClient* c = new LoadClient();
+    clients.push_back(c);
+    if (!openClient(c, i)) {
+      c->state = CLIENT_FAILED;
+    }
+  }
+
+  int64_t start = nowUsec();
+  int64_t lastReport = start;
+  while (seconds == 0 || nowUsec() - start < (int64_t)seconds * 1000000) {
+    fd_set readSet;
+    FD_ZERO(&readSet);
+    int maxFd = -1;
+    for (LoadClient* c : clients) {
+      if (c->state == CLIENT_FAILED) {
+        continue;
+      }
+      FD_SET(c->ctrlFd, &readSet);
+      maxFd = std::max(maxFd, c->ctrlFd);
+      if (c->rtpFd >= 0) {
+        FD_SET(c->rtpFd, &readSet);
+        maxFd = std::max(maxFd, c->rtpFd);
+      }
+    }
+    struct timeval tv = { 0, 100000 };
+    if (maxFd >= 0 && select(maxFd + 1, &readSet, NULL, NULL, &tv) > 0) {
+      for (LoadClient* c : clients) {
+        if (c->state == CLIENT_FAILED) {
+          continue;
+        }
+        if (FD_ISSET(c->ctrlFd, &readSet)) {
+          handleControl(c);
+        }
+        if (c->rtpFd >= 0 && FD_ISSET(c->rtpFd, &readSet)) {
+          int n;
+          while ((n = recv(c->rtpFd, c->rtp, sizeof(c->rtp), MSG_DONTWAIT)) > 0) {
+            handleRtp(c, c->rtp, n);
+          }
+        }
+      }
+    } else if (maxFd < 0) {
+      usleep(100000);
+    }
+
+    int64_t now = nowUsec();
+    if (now - lastReport >= (int64_t)reportMsec * 1000) {
+      report((now - lastReport) / 1000);
+      lastReport = now;
+    }
+  }
+  report((nowUsec() - lastReport) / 1000);
+
+  int failed = 0;
+  for (LoadClient* c : clients) {
+    if (c->state != CLIENT_STREAMING || c->complete == 0) {
+      failed++;
+    }
+  }
+  printf("%d of %d clients streamed complete frames\n", count - failed, count);
+  return failed ? 1 : 0;
+}
@@ -0,0 +1,89 @@
+#include "EasyRTSPServer.h"
+#include "MJPEGFileSource.h"
+#include <getopt.h>
+
+//
+// The server on Linux, streaming a recorded MJPEG file in a loop, e.g. for loadgen
+// on the same machine. Every run sees the same frames, so changes can be load tested
+// reproducibly and with more clients than a board has sockets for.
+//
+//   server [-p port] [-s suffix] [-r fps] [-c max clients] file.mjpeg
+//
+// A recording is a plain concatenation of JPEG frames, cat frames/*.jpg makes one.
+//
+
+#define SERVER_PORT 8554
+#define SERVER_SUFFIX "mjpeg/1"
+#define SERVER_FPS 20
+#define SERVER_CLIENTS 64
+#define SERVER_REPORT_MS 5000
+
+static void usage() {
+  printf("usage: server [-p port] [-s suffix] [-r fps] [-c max clients] file.mjpeg\n");
+}
+
+int main(int argc, char** argv) {
+  int port = SERVER_PORT;
+  const char* suffix = SERVER_SUFFIX;
+  float fps = SERVER_FPS;
+  int clients = SERVER_CLIENTS;
+  int opt;
+  while ((opt = getopt(argc, argv, "p:s:r:c:h")) != -1) {
+    switch (opt) {
+      case 'p':
+        port = atoi(optarg);
+        break;
+      case 's':
+        suffix = optarg;
+        break;
+      case 'r':
+        fps = atof(optarg);
+        break;
+      case 'c':
+        clients = atoi(optarg);
+        break;
+      default:
+        usage();
+        return 1;
+    }
+  }
+  if (optind != argc - 1) {
+    usage();
+    return 1;
+  }
+
+  static fs::FS files;
+  static MJPEGFileSource source(files, argv[optind], fps, true);
+  if (!source.begin()) {
+    printf("can't replay %s\n", argv[optind]);
+    return 1;
+  }
+  static EasyRTSPServer server(port);
+  server.setStreamSuffix(suffix);
+  server.setFrameRate(FRAMERATE_UNLIMITED);  // the file source keeps the recorded pace
+  server.setMaxClients(clients);
+  server.init(&source);
+  printf("rtsp://%s:%d/%s, %dx%d at %.1f fps, up to %d clients\n", WiFi.localIP().toString().c_str(), port, suffix,
+         source.getWidth(), source.getHeight(), fps, clients);
+  fflush(stdout);
+
+  uint32_t lastReport = millis();
+  while (true) {
+    server.run();
+    uint32_t now = millis();
+    if (now - lastReport >= SERVER_REPORT_MS) {
+      lastReport = now;
+      StreamStats stats = server.getStreamStats();
+      int sessions = 0;
+      for (int i = 0; i < server.getMaxClients(); i++) {
+        RTSPSession* session = server.getSession(i);
+        if (session && session->Status() == SessionStatus::STATUS_STREAMING) {
+          sessions++;
+        }
+      }
+      printf("server %u frames, %u.%02u fps, %u overruns, %d sessions streaming\n",
+             stats.frames, stats.fps100 / 100, stats.fps100 % 100, stats.overruns, sessions);
+      fflush(stdout);
+    }
+  }
+}
@@ -0,0 +1,204 @@
+#include "EasyRTSPServer.h"
+#include <vector>
+
+//
+// An H.264 session must not get pictures whose reference went missing. Every way a
+// frame can be skipped on the way to the socket is tried, then the next frame that
+// reaches the client has to be an IDR picture:
+//   - the network loop only takes the newest frame of the ring, one P frame is never seen
+//   - a P frame arrives while the one before still waits in the queue
+//   - a session joins mid GOP
+//   - a session resumes after PAUSE
+//
+
+#define TEST_PORT 50100
+
+// Frames are written into the ring by the test itself
+class NullSource : public FrameSource {
+public:
+  bool capture(CamFrame* frame) override { return false; }
+  void release(CamFrame* frame) override {}
+  int getWidth() override { return 320; }
+  int getHeight() override { return 240; }
+  FrameCodec getCodec() override { return CODEC_H264; }
+};
+
+static const uint8_t IDR_HEAD[] = {
+  0, 0, 0, 1, 0x67, 0x42, 0xc0, 0x1e, 0xda, 0x02, 0x80, 0xf6, 0x40,  // SPS
+  0, 0, 0, 1, 0x68, 0xce, 0x3c, 0x80,                                // PPS
+  0, 0, 0, 1, 0x65                                                   // IDR slice
+};
+static const uint8_t P_HEAD[] = { 0, 0, 0, 1, 0x41 };
+
+static NullSource source;
+static FrameRing ring;
+static RTPFrame rtpFrames[FRAME_RING_SIZE];
+static std::vector<uint8_t> frameData[FRAME_RING_SIZE];
+static uint32_t lastSeq = 0;
+static uint32_t frameMsec = 1000;
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+  printf("%s  %s\n", ok ? "ok  " : "FAIL", what);
+  if (!ok) {
+    failures++;
+  }
+}
+
+// A whole access unit, the slice padded so the IDR picture needs several FU-A packets
+static void publish(bool idr) {
+  FrameSlot* slot = ring.acquireWrite();
+  std::vector<uint8_t>& data = frameData[ring.indexOf(slot)];
+  if (idr) {
+    data.assign(IDR_HEAD, IDR_HEAD + sizeof(IDR_HEAD));
+    data.resize(data.size() + 4000, 0x88);
+  } else {
+    data.assign(P_HEAD, P_HEAD + sizeof(P_HEAD));
+    data.resize(data.size() + 600, 0x99);
+  }
+  slot->frame.buf = data.data();
+  slot->frame.len = data.size();
+  frameMsec += 40;
+  ring.publish(slot, frameMsec);
+}
+
+// What RTSPMount::run() does with the newest frame
+static void deliver(RTPSender* sender) {
+  FrameSlot* slot = ring.acquireLatest(lastSeq);
+  if (!slot) {
+    return;
+  }
+  lastSeq = slot->seq;
+  RTPFrame* frame = &rtpFrames[ring.indexOf(slot)];
+  if (frame->packH264(slot->frame.buf, slot->frame.len)) {
+    sender->enqueueFrame(&ring, slot, frame);
+  }
+  ring.release(slot);
+}
+
+// The frames the client got, in order, as true for an IDR picture and false for
+// anything else. A frame is the packets of one RTP timestamp.
+static std::vector<bool> receive(UDPSocket* client) {
+  std::vector<bool> frames;
+  uint8_t packet[2048];
+  bool inFrame = false;
+  uint32_t ts = 0;
+  int n;
+  while ((n = client->recv(packet, sizeof(packet))) > 0) {
+    if (n <= 13) {
+      continue;
+    }
+    uint32_t packetTs = ((uint32_t)packet[4] << 24) | (packet[5] << 16) | (packet[6] << 8) | packet[7];
+    if (!inFrame || packetTs != ts) {
+      frames.push_back(false);
+      inFrame = true;
+      ts = packetTs;
+    }
+    const uint8_t* payload = packet + 12;
+    uint8_t type = payload[0] & 0x1f;
+    if (type == 28) {  // FU-A
+      type = payload[1] & 0x1f;
+    } else if (type == 24) {  // STAP-A, every unit of the aggregate
+      for (int i = 1; i + 2 < n - 12;) {
+        int len = (payload[i] << 8) | payload[i + 1];
+        if ((payload[i + 2] & 0x1f) == 5) {
+          type = 5;
+        }
+        i += 2 + len;
+      }
+    }
+    if (type == 5) {
+      frames.back() = true;
+    }
+  }
+  return frames;
+}
+
+static bool sent(const std::vector<bool>& frames, std::initializer_list<bool> expect) {
+  return frames == std::vector<bool>(expect);
+}
+
+int main() {
+  ring.init(&source);
+  UDPSocket client, server;
+  if (!client.begin(TEST_PORT) || !server.begin(TEST_PORT + 2)) {
+    printf("no loopback sockets\n");
+    return 1;
+  }
+  static RTPSender sender;
+  sender.setUdp(&server, IPAddress(127, 0, 0, 1), TEST_PORT);
+
+  // joins on a P frame, waits for the IDR picture
+  publish(false);
+  deliver(&sender);
+  sender.flush();
+  publish(true);
+  deliver(&sender);
+  sender.flush();
+  publish(false);
+  deliver(&sender);
+  sender.flush();
+  usleep(10000);
+  check(sent(receive(&client), { true, false }), "a session that joins mid GOP starts on the IDR picture");
+
+  // the network loop falls behind, the ring skips a P frame
+  publish(false);
+  publish(false);
+  deliver(&sender);
+  sender.flush();
+  publish(false);
+  deliver(&sender);
+  sender.flush();
+  publish(true);
+  deliver(&sender);
+  sender.flush();
+  usleep(10000);
+  check(sent(receive(&client), { true }), "after a P frame skipped by the ring the next frame sent is an IDR picture");
+
+  // the socket falls behind, a P frame meets a full queue
+  publish(false);
+  deliver(&sender);  // being sent
+  publish(false);
+  deliver(&sender);  // waits
+  publish(false);
+  deliver(&sender);  // skipped
+  sender.flush();
+  publish(false);
+  deliver(&sender);
+  sender.flush();
+  publish(true);
+  deliver(&sender);
+  sender.flush();
+  usleep(10000);
+  check(sent(receive(&client), { false, false, true }), "after a P frame dropped by the queue the next frame sent is an IDR picture");
+
+  // PAUSE and PLAY again
+  publish(false);
+  deliver(&sender);
+  sender.flush();
+  sender.pause(millis());
+  sender.resume(millis());
+  publish(false);
+  deliver(&sender);
+  sender.flush();
+  publish(true);
+  deliver(&sender);
+  sender.flush();
+  usleep(10000);
+  check(sent(receive(&client), { false, true }), "after PAUSE the first frame sent is an IDR picture");
+
+  // nothing lost, every P frame goes out
+  publish(false);
+  deliver(&sender);
+  sender.flush();
+  publish(false);
+  deliver(&sender);
+  sender.flush();
+  usleep(10000);
+  check(sent(receive(&client), { false, false }), "without losses P frames are sent");
+
+  client.stop();
+  server.stop();
+  printf("%s\n", failures ? "FAILED" : "passed");
+  return failures ? 1 : 0;
+}
@@ -1,5 +1,12 @@
 #include "EasyRTSPServer.h"
 #include "base64.h"
+#include "RTSPLog.h"
+#include "esp_timer.h"
+#include <stdarg.h>
+#include <sys/time.h>
+#if defined(__linux__)
+#include <netinet/udp.h>
+#endif
 
 char const* DateHeader() {
   static char buf[128] = { 0 };
@@ -8,92 +15,988 @@ char const* DateHeader() {
   return buf;
 }
 
-void RTPPacket::setRtpHeader(uint32_t seq, uint32_t timestamp) {
-  m_rtpBuf[7] = seq & 0x0FF;               // each packet is counted with a sequence counter
-  m_rtpBuf[6] = seq >> 8;
-  
-  m_rtpBuf[8] = (timestamp & 0xFF000000) >> 24;  // each image gets a timestamp
-  m_rtpBuf[9] = (timestamp & 0x00FF0000) >> 16;
-  m_rtpBuf[10] = (timestamp & 0x0000FF00) >> 8;
-  m_rtpBuf[11] = (timestamp & 0x000000FF);
+bool RTPFrame::packFrame(const JpegInfo& jpeg) {
+  m_codec = CODEC_JPEG;
+  m_jpeg = jpeg.scan;
+  m_payloadLen = jpeg.scanLen;
+
+  memset(m_hdrTemplate, 0x00, sizeof(m_hdrTemplate));
+  // Prepare the first 4 byte of the packet. This is the Rtp over Rtsp header in case of TCP based transport
+  m_hdrTemplate[0] = '$';  // magic number
+  m_hdrTemplate[1] = 0;    // number of multiplexed subchannel on RTPS connection - here the RTP channel
+  // Prepare the 12 byte RTP header, seq/timestamp/SSRC are patched per session in buildPacket()
+  m_hdrTemplate[4] = 0x80;  // RTP version
+  m_hdrTemplate[5] = 0x1a;  // JPEG payload (26), marker bit is set on the last fragment
+
+  /*    These sampling factors indicate that the chrominance components of
+       type 0 video is downsampled horizontally by 2 (often called 4:2:2)
+       while the chrominance components of type 1 video are downsampled both
+       horizontally and vertically by 2 (often called 4:2:0).
+       Types 64-127 are the same with restart markers in the scan. */
+  uint8_t type = jpeg.type + (jpeg.restartInterval ? 64 : 0);
+  m_hdrTemplate[16] = 0x00;                // type specific
+  m_hdrTemplate[20] = type;                // https://tools.ietf.org/html/rfc2435
+  m_hdrTemplate[21] = 255;                 // Q 255: the quant tables are in-band and may change every frame
+  m_hdrTemplate[22] = jpeg.width / 8;      // width  / 8
+  m_hdrTemplate[23] = jpeg.height / 8;     // height / 8
+  m_baseHeaderLen = KRtpPrefixSize + KRtpHeaderSize + KJpegHeaderSize;
+
+  m_restartCount = 0;
+  if (jpeg.restartInterval) {  // sent in every packet, F/L bits and count are set per fragment
+    char* restart = m_hdrTemplate + m_baseHeaderLen;
+    restart[0] = jpeg.restartInterval >> 8;
+    restart[1] = jpeg.restartInterval & 0xFF;
+    m_baseHeaderLen += KRestartHeaderSize;
+    findRestarts();
+  }
+
+  // the quant header is only sent in the first packet of the frame
+  char* quant = m_hdrTemplate + m_baseHeaderLen;
+  quant[0] = 0;  // MBZ
+  quant[1] = 0;  // 8 bit precision
+  quant[2] = 0;  // MSB of lentgh
+
+  int numQantBytes = 64;         // Two 64 byte tables
+  quant[3] = 2 * numQantBytes;   // LSB of length
+
+  memcpy(quant + 4, jpeg.qtable0, numQantBytes);
+  memcpy(quant + 4 + numQantBytes, jpeg.qtable1, numQantBytes);
+
+  return m_payloadLen > 0;
 }
 
-int RTPPacket::packRtpPack(unsigned const char* jpeg, uint32_t jpegLen, int fragmentOffset, BufPtr quant0tbl, BufPtr quant1tbl, StreamInfo* streamInfo) {
-  int fragmentLen = MAX_FRAGMENT_SIZE;
-  if (fragmentLen + fragmentOffset > jpegLen)  // Shrink last fragment if needed
-    fragmentLen = jpegLen - fragmentOffset;
+// Splits the access unit at its 3 or 4 byte start codes (RFC 6184 carries NAL units without them)
+bool RTPFrame::packH264(BufPtr data, uint32_t len) {
+  m_codec = CODEC_H264;
+  m_keyframe = false;
+  m_nalCount = 0;
+  m_payloadLen = 0;
+  m_sps = NULL;
+  m_spsLen = 0;
+  m_pps = NULL;
+  m_ppsLen = 0;
+
+  memset(m_hdrTemplate, 0x00, KRtpPrefixSize + KRtpHeaderSize);
+  m_hdrTemplate[0] = '$';
+  m_hdrTemplate[1] = 0;
+  m_hdrTemplate[4] = 0x80;
+  m_hdrTemplate[5] = RTP_PAYLOAD_TYPE_H264;
+  m_baseHeaderLen = KRtpPrefixSize + KRtpHeaderSize;
+
+  uint32_t i = 0;
+  BufPtr nal = NULL;
+  while (i + 3 <= len) {
+    if (data[i] != 0 || data[i + 1] != 0 || data[i + 2] != 1) {
+      i++;
+      continue;
+    }
+    if (nal) {  // a start code ends the previous unit, its leading zero byte included
+      uint32_t end = i;
+      while (end > (uint32_t)(nal - data) && data[end - 1] == 0) {
+        end--;
+      }
+      if (m_nalCount == RTP_MAX_NAL_UNITS) {
+        RTSP_LOGW("more than %d NAL units in a frame", RTP_MAX_NAL_UNITS);
+        return false;
+      }
+      m_nals[m_nalCount++] = { nal, (uint32_t)(data + end - nal), 0 };
+    }
+    i += 3;
+    nal = data + i;
+  }
+  if (nal && nal < data + len) {
+    if (m_nalCount == RTP_MAX_NAL_UNITS) {
+      RTSP_LOGW("more than %d NAL units in a frame", RTP_MAX_NAL_UNITS);
+      return false;
+    }
+    m_nals[m_nalCount++] = { nal, (uint32_t)(data + len - nal), 0 };
+  }
 
-  m_isLastFragment = (fragmentOffset + fragmentLen) == jpegLen;
+  int n = 0;
+  for (int k = 0; k < m_nalCount; k++) {
+    NalUnit unit = m_nals[k];
+    if (unit.len == 0) {
+      continue;
+    }
+    uint8_t type = unit.data[0] & 0x1F;
+    if (type == 7) {
+      m_sps = unit.data;
+      m_spsLen = unit.len;
+    } else if (type == 8) {
+      m_pps = unit.data;
+      m_ppsLen = unit.len;
+    } else if (type == 9) {
+      continue;  // access unit delimiter, the RTP timestamp and marker bit do its job
+    } else if (type == 5) {
+      m_keyframe = true;  // IDR slice
+    }
+    unit.start = m_payloadLen;
+    m_payloadLen += unit.len;
+    m_nals[n++] = unit;
+  }
+  m_nalCount = n;
+  return m_payloadLen > 0;
+}
 
-  // Do we have custom quant tables? If so include them per RFC
+// An interval starts behind each RSTn marker (FF D0 - FF D7) of the scan. Once the table
+// is full every other entry is dropped and the stride doubles, the table only saves
+// buildJpegHeader() from counting the intervals from the start of the scan.
+void RTPFrame::findRestarts() {
+  m_restarts[0] = 0;
+  m_restartCount = 1;
+  m_restartStride = 1;
+  uint32_t intervals = 1;
+  BufPtr p = m_jpeg;
+  BufPtr end = m_jpeg + m_payloadLen;
+  while (p + 1 < end && (p = (BufPtr)memchr(p, 0xFF, end - 1 - p)) != NULL) {
+    if (p[1] < 0xD0 || p[1] > 0xD7) {
+      p++;
+      continue;
+    }
+    p += 2;
+    if (intervals++ % m_restartStride != 0 || p == end) {
+      continue;
+    }
+    if (m_restartCount == RTP_MAX_RESTART_GROUPS) {
+      for (int i = 0; i < RTP_MAX_RESTART_GROUPS / 2; i++) {
+        m_restarts[i] = m_restarts[2 * i];
+      }
+      m_restartCount = RTP_MAX_RESTART_GROUPS / 2;
+      m_restartStride *= 2;
+      if ((intervals - 1) % m_restartStride != 0) {
+        continue;
+      }
+    }
+    m_restarts[m_restartCount++] = p - m_jpeg;
+  }
+}
 
-  bool includeQuantTbl = quant0tbl && quant1tbl && fragmentOffset == 0;
-  uint8_t q = includeQuantTbl ? 128 : 0x5e;
+// offset right after the first restart marker that lies within [from, to), 0 if there is none
+uint32_t RTPFrame::nextRestart(uint32_t from, uint32_t to) {
+  BufPtr p = m_jpeg + from;
+  BufPtr end = m_jpeg + to;
+  while (p + 1 < end && (p = (BufPtr)memchr(p, 0xFF, end - 1 - p)) != NULL) {
+    if (p[1] >= 0xD0 && p[1] <= 0xD7) {
+      return p + 2 - m_jpeg;
+    }
+    p++;
+  }
+  return 0;
+}
 
-  m_RtpPacketSize = fragmentLen + KRtpHeaderSize + KJpegHeaderSize + (includeQuantTbl ? (4 + 64 * 2) : 0);
+int RTPFrame::buildJpegHeader(uint32_t* offset, int maxPacketSize, char* header, BufPtr* payload, int* payloadLen, bool* last) {
+  bool quant = *offset == 0;  // the quant table header only goes with the first fragment
+  int headerLen = m_baseHeaderLen + (quant ? KQuantHeaderSize : 0);
+  uint32_t len = maxPacketSize - (headerLen - KRtpPrefixSize);
+  if (len > m_payloadLen - *offset)  // Shrink last fragment if needed
+    len = m_payloadLen - *offset;
+
+  memcpy(header, m_hdrTemplate, headerLen);
+  if (m_restartCount > 0) {
+    // the interval *offset lies in, counted on from the nearest indexed one
+    int k = 0;
+    while (k + 1 < m_restartCount && m_restarts[k + 1] <= *offset) {
+      k++;
+    }
+    uint32_t count = k * m_restartStride;
+    uint32_t start = m_restarts[k];
+    for (uint32_t next; (next = nextRestart(start, *offset)) != 0; start = next) {
+      count++;
+    }
+    bool first = *offset == start;
+
+    // Whole intervals up to the last one that fits. A packet that continues an interval
+    // only takes its rest, an interval larger than the packet goes out in pieces.
+    uint32_t limit = *offset + len;
+    uint32_t end = 0;
+    for (uint32_t next = *offset; (next = nextRestart(next, limit)) != 0;) {
+      end = next;
+      if (!first) {
+        break;
+      }
+    }
+    if (limit == m_payloadLen && (first || end == 0)) {
+      end = m_payloadLen;
+    }
+    if (end > *offset) {
+      len = end - *offset;
+    }
+    char* restart = header + KRtpPrefixSize + KRtpHeaderSize + KJpegHeaderSize;
+    restart[2] = (first ? 0x80 : 0) | (end > *offset ? 0x40 : 0) | ((count >> 8) & 0x3F);
+    restart[3] = count & 0xFF;
+  }
+  header[17] = (*offset & 0x00FF0000) >> 16;  // 3 byte fragmentation offset for fragmented images
+  header[18] = (*offset & 0x0000FF00) >> 8;
+  header[19] = (*offset & 0x000000FF);
+
+  *payload = m_jpeg + *offset;
+  *payloadLen = len;
+  *offset += len;
+  *last = *offset == m_payloadLen;
+  return headerLen;
+}
 
-  memset(m_rtpBuf, 0x00, sizeof(m_rtpBuf));
-  // Prepare the first 4 byte of the packet. This is the Rtp over Rtsp header in case of TCP based transport
-  m_rtpBuf[0] = '$';  // magic number
-  m_rtpBuf[1] = 0;    // number of multiplexed subchannel on RTPS connection - here the RTP channel
-  m_rtpBuf[2] = (m_RtpPacketSize & 0x0000FF00) >> 8;
-  m_rtpBuf[3] = (m_RtpPacketSize & 0x000000FF);
-  // Prepare the 12 byte RTP header
-  m_rtpBuf[4] = 0x80;                                   // RTP version
-  m_rtpBuf[5] = 0x1a | (m_isLastFragment ? 0x80 : 0x00);  // JPEG payload (26) and marker bit
-  m_rtpBuf[12] = 0x13;  // 4 byte SSRC (sychronization source identifier)
-  m_rtpBuf[13] = 0xf9;  // we just an arbitrary number here to keep it simple
-  m_rtpBuf[14] = 0x7e;
-  m_rtpBuf[15] = 0x67;
-
-  // Prepare the 8 byte payload JPEG header
-  m_rtpBuf[16] = 0x00;                                 // type specific
-  m_rtpBuf[17] = (fragmentOffset & 0x00FF0000) >> 16;  // 3 byte fragmentation offset for fragmented images
-  m_rtpBuf[18] = (fragmentOffset & 0x0000FF00) >> 8;
-  m_rtpBuf[19] = (fragmentOffset & 0x000000FF);
+int RTPFrame::buildH264Header(uint32_t* offset, int maxPacketSize, char* header, BufPtr* payload, int* payloadLen, bool* last) {
+  int room = maxPacketSize - KRtpHeaderSize;
+  int k = 0;
+  while (k < m_nalCount - 1 && m_nals[k + 1].start <= *offset) {
+    k++;
+  }
+  const NalUnit& unit = m_nals[k];
+  uint32_t pos = *offset - unit.start;
+  memcpy(header, m_hdrTemplate, m_baseHeaderLen);
+  char* p = header + m_baseHeaderLen;
+
+  // STAP-A: the small units at the start of the frame, copied behind the RTP header.
+  // The header room reserved for the JPEG tables of a first packet holds them.
+  const int stapRoom = KRtpMaxHeaderSize - m_baseHeaderLen;
+  if (*offset == 0) {
+    int count = 0;
+    int size = 1;
+    uint8_t nri = 0;
+    while (count < m_nalCount && size + 2 + (int)m_nals[count].len <= min(stapRoom, room)) {
+      size += 2 + m_nals[count].len;
+      nri = max(nri, (uint8_t)(m_nals[count].data[0] & 0x60));
+      count++;
+    }
+    if (count >= 2) {
+      *p++ = nri | 24;
+      for (int i = 0; i < count; i++) {
+        *p++ = m_nals[i].len >> 8;
+        *p++ = m_nals[i].len & 0xFF;
+        memcpy(p, m_nals[i].data, m_nals[i].len);
+        p += m_nals[i].len;
+      }
+      *payload = NULL;
+      *payloadLen = 0;
+      *offset = count < m_nalCount ? m_nals[count].start : m_payloadLen;
+      *last = count == m_nalCount;
+      return p - header;
+    }
+  }
 
-  /*    These sampling factors indicate that the chrominance components of
-       type 0 video is downsampled horizontally by 2 (often called 4:2:2)
-       while the chrominance components of type 1 video are downsampled both
-       horizontally and vertically by 2 (often called 4:2:0). */
-  m_rtpBuf[20] = 0x00;                        // type (fixme might be wrong for camera data) https://tools.ietf.org/html/rfc2435
-  m_rtpBuf[21] = q;                           // quality scale factor was 0x5e
-  m_rtpBuf[22] = streamInfo->m_width / 8;   // width  / 8
-  m_rtpBuf[23] = streamInfo->m_height / 8;  // height / 8
+  if (pos == 0 && (int)unit.len <= room) {  // single NAL unit packet
+    *payload = unit.data;
+    *payloadLen = unit.len;
+  } else {  // FU-A, the NAL header byte is spread over FU indicator and FU header
+    if (pos == 0) {
+      pos = 1;
+    }
+    uint32_t len = room - KFuHeaderSize;
+    if (len > unit.len - pos) {
+      len = unit.len - pos;
+    }
+    *p++ = (unit.data[0] & 0xE0) | 28;
+    *p++ = (pos == 1 ? 0x80 : 0) | (pos + len == unit.len ? 0x40 : 0) | (unit.data[0] & 0x1F);
+    *payload = unit.data + pos;
+    *payloadLen = len;
+  }
+  *offset = unit.start + (*payload - unit.data) + *payloadLen;
+  *last = *offset == m_payloadLen;
+  return p - header;
+}
 
-  int headerLen = 24;     // Inlcuding jpeg header but not qant table header
-  if (includeQuantTbl) {  // we need a quant header - but only in first packet of the frame
-    //if ( debug ) printf("inserting quanttbl\n");
-    m_rtpBuf[24] = 0;  // MBZ
-    m_rtpBuf[25] = 0;  // 8 bit precision
-    m_rtpBuf[26] = 0;  // MSB of lentgh
+int RTPFrame::buildHeader(uint32_t* offset, int maxPacketSize, uint16_t seq, uint32_t timestamp, uint32_t ssrc, char* header, BufPtr* payload, int* payloadLen) {
+  bool last;
+  int headerLen = m_codec == CODEC_H264 ? buildH264Header(offset, maxPacketSize, header, payload, payloadLen, &last)
+                                        : buildJpegHeader(offset, maxPacketSize, header, payload, payloadLen, &last);
+  int packetSize = headerLen - KRtpPrefixSize + *payloadLen;
 
-    int numQantBytes = 64;          // Two 64 byte tables
-    m_rtpBuf[27] = 2 * numQantBytes;  // LSB of length
+  header[2] = (packetSize & 0x0000FF00) >> 8;
+  header[3] = (packetSize & 0x000000FF);
+  if (last) {
+    header[5] |= 0x80;  // marker bit on the last packet of the frame
+  }
 
-    headerLen += 4;
+  header[6] = seq >> 8;                    // each packet is counted with a sequence counter
+  header[7] = seq & 0x0FF;
+  header[8] = (timestamp & 0xFF000000) >> 24;  // each image gets a timestamp
+  header[9] = (timestamp & 0x00FF0000) >> 16;
+  header[10] = (timestamp & 0x0000FF00) >> 8;
+  header[11] = (timestamp & 0x000000FF);
+  header[12] = (ssrc & 0xFF000000) >> 24;  // 4 byte SSRC (sychronization source identifier)
+  header[13] = (ssrc & 0x00FF0000) >> 16;
+  header[14] = (ssrc & 0x0000FF00) >> 8;
+  header[15] = (ssrc & 0x000000FF);
+
+  return headerLen;
+}
 
-    memcpy(m_rtpBuf + headerLen, quant0tbl, numQantBytes);
-    headerLen += numQantBytes;
+bool UDPSocket::begin(uint16_t port) {
+  stop();
+  m_fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+  if (m_fd < 0) {
+    RTSP_LOGE("could not create udp socket: %d", errno);
+    return false;
+  }
+  int yes = 1;
+  setsockopt(m_fd, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+
+  struct sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  if (bind(m_fd, (struct sockaddr*)&addr, sizeof(addr)) < 0) {
+    RTSP_LOGE("could not bind udp port %d: %d", port, errno);
+    stop();
+    return false;
+  }
+  return true;
+}
 
-    memcpy(m_rtpBuf + headerLen, quant1tbl, numQantBytes);
-    headerLen += numQantBytes;
+void UDPSocket::stop() {
+  if (m_fd >= 0) {
+    close(m_fd);
+    m_fd = -1;
   }
-  // if ( debug ) printf("Sending timestamp %d, seq %d, fragoff %d, fraglen %d, jpegLen %d\n", m_Timestamp, m_SequenceNumber, fragmentOffset, fragmentLen, jpegLen);
+}
 
-  // append the JPEG scan data to the RTP buffer
-  memcpy(m_rtpBuf + headerLen, jpeg + fragmentOffset, fragmentLen);
-  fragmentOffset += fragmentLen;
+bool UDPSocket::setMulticastTTL(uint8_t ttl) {
+  if (m_fd < 0) {
+    return false;
+  }
+  return setsockopt(m_fd, IPPROTO_IP, IP_MULTICAST_TTL, &ttl, sizeof(ttl)) == 0;
+}
 
-  return m_isLastFragment ? 0 : fragmentOffset;
+int UDPSocket::sendv(const struct iovec* iov, int iovcnt, IPAddress ip, uint16_t port) {
+  if (m_fd < 0) {
+    return -1;
+  }
+  struct sockaddr_in dest;
+  memset(&dest, 0, sizeof(dest));
+  dest.sin_family = AF_INET;
+  dest.sin_port = htons(port);
+  dest.sin_addr.s_addr = (uint32_t)ip;
+
+  struct msghdr msg;
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_name = &dest;
+  msg.msg_namelen = sizeof(dest);
+  msg.msg_iov = (struct iovec*)iov;
+  msg.msg_iovlen = iovcnt;
+  return sendmsg(m_fd, &msg, 0);
 }
 
-RTSPSession::RTSPSession(WiFiClient* client, StreamInfo* streamInfo) {
-  m_tcpClient = client;
-  m_streamInfo = streamInfo;
+// Each packet is one datagram without the '$' prefix. Linux hands the whole batch to
+// the kernel at once, with UDP_SEGMENT (GSO) the kernel even cuts it into datagrams
+// itself: every packet but the last of a frame is exactly the packet size.
+// lwIP has neither, there it is one sendmsg() per packet.
+int UDPSocket::sendBatch(const RTPPacket* packets, int count, IPAddress ip, uint16_t port, uint32_t* bytes) {
+  *bytes = 0;
+  if (m_fd < 0) {
+    return count;
+  }
+  struct sockaddr_in dest;
+  memset(&dest, 0, sizeof(dest));
+  dest.sin_family = AF_INET;
+  dest.sin_port = htons(port);
+  dest.sin_addr.s_addr = (uint32_t)ip;
+
+  struct iovec iov[2 * RTP_MAX_BATCH];
+  uint32_t size[RTP_MAX_BATCH];  // of each datagram
+  for (int i = 0; i < count; i++) {
+    iov[2 * i].iov_base = packets[i].header + KRtpPrefixSize;
+    iov[2 * i].iov_len = packets[i].headerLen - KRtpPrefixSize;
+    iov[2 * i + 1].iov_base = (void*)packets[i].payload;
+    iov[2 * i + 1].iov_len = packets[i].payloadLen;
+    size[i] = iov[2 * i].iov_len + iov[2 * i + 1].iov_len;
+  }
+
+#if defined(__linux__) && defined(UDP_SEGMENT)
+  // the kernel cuts the batch into equal segments, only the last one may be shorter
+  uint16_t segment = size[0];
+  bool uniform = true;
+  for (int i = 1; i < count && uniform; i++) {
+    uniform = i < count - 1 ? size[i] == segment : size[i] <= segment;
+  }
+  if (count > 1 && m_gso && uniform) {
+    char control[CMSG_SPACE(sizeof(segment))];
+    memset(control, 0, sizeof(control));
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_name = &dest;
+    msg.msg_namelen = sizeof(dest);
+    msg.msg_iov = iov;
+    msg.msg_iovlen = 2 * count;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+    struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_UDP;
+    cmsg->cmsg_type = UDP_SEGMENT;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(segment));
+    memcpy(CMSG_DATA(cmsg), &segment, sizeof(segment));
+    int res = sendmsg(m_fd, &msg, 0);
+    if (res >= 0) {
+      *bytes = res;
+      return 0;
+    }
+    if (errno == EIO || errno == EINVAL || errno == ENOPROTOOPT) {  // no GSO on this kernel or device
+      m_gso = false;
+    }
+  }
+#endif
+
+#if defined(__linux__)
+  struct mmsghdr msgs[RTP_MAX_BATCH];
+  memset(msgs, 0, sizeof(msgs));
+  for (int i = 0; i < count; i++) {
+    msgs[i].msg_hdr.msg_name = &dest;
+    msgs[i].msg_hdr.msg_namelen = sizeof(dest);
+    msgs[i].msg_hdr.msg_iov = &iov[2 * i];
+    msgs[i].msg_hdr.msg_iovlen = 2;
+  }
+  int sent = sendmmsg(m_fd, msgs, count, 0);
+  for (int i = 0; i < sent; i++) {
+    *bytes += size[i];
+  }
+  return sent < 0 ? count : count - sent;
+#else
+  int failed = 0;
+  struct msghdr msg;
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_name = &dest;
+  msg.msg_namelen = sizeof(dest);
+  msg.msg_iovlen = 2;
+  for (int i = 0; i < count; i++) {
+    msg.msg_iov = &iov[2 * i];
+    if (sendmsg(m_fd, &msg, 0) < 0) {
+      failed++;
+    } else {
+      *bytes += size[i];
+    }
+  }
+  return failed;
+#endif
+}
+
+int UDPSocket::recv(uint8_t* data, int len) {
+  if (m_fd < 0) {
+    return -1;
+  }
+  return recvfrom(m_fd, data, len, MSG_DONTWAIT, NULL, NULL);
+}
+
+// drop the first bytes of an iovec array
+static void advanceIov(struct iovec** iov, int* iovcnt, int bytes) {
+  while (*iovcnt > 0 && (size_t)bytes >= (*iov)->iov_len) {  // skip the iovecs that went out completely
+    bytes -= (*iov)->iov_len;
+    (*iov)++;
+    (*iovcnt)--;
+  }
+  if (*iovcnt > 0) {
+    (*iov)->iov_base = (char*)(*iov)->iov_base + bytes;
+    (*iov)->iov_len -= bytes;
+  }
+}
+
+void TCPSocket::attach(int fd) {
+  stop();
+  m_fd = fd;
+  m_outLen = 0;
+  m_overflow = false;
+}
+
+void TCPSocket::stop() {
+  if (m_fd >= 0) {
+    close(m_fd);
+    m_fd = -1;
+  }
+}
+
+size_t TCPSocket::write(const char* data, size_t len) {
+  if (m_fd < 0 || m_overflow) {
+    return 0;
+  }
+  if (len > sizeof(m_out) - m_outLen) {  // the client doesn't read its replies
+    m_overflow = true;
+    return 0;
+  }
+  memcpy(m_out + m_outLen, data, len);
+  m_outLen += len;
+  return len;
+}
+
+char* TCPSocket::reserve(size_t* room) {
+  *room = m_fd < 0 || m_overflow ? 0 : sizeof(m_out) - m_outLen;
+  return m_out + m_outLen;
+}
+
+void TCPSocket::commit(size_t len) {
+  m_outLen += len;
+}
+
+int TCPSocket::flush() {
+  while (m_outLen > 0) {
+    int res = send(m_fd, m_out, m_outLen, MSG_DONTWAIT);
+    if (res < 0) {
+      return errno == EAGAIN || errno == EWOULDBLOCK ? 0 : -1;
+    }
+    memmove(m_out, m_out + res, m_outLen - res);
+    m_outLen -= res;
+  }
+  return m_overflow ? -1 : 1;
+}
+
+IPAddress TCPSocket::remoteIP() {
+  struct sockaddr_in addr;
+  socklen_t len = sizeof(addr);
+  if (m_fd < 0 || getpeername(m_fd, (struct sockaddr*)&addr, &len) < 0) {
+    return IPAddress();
+  }
+  return IPAddress((uint32_t)addr.sin_addr.s_addr);
+}
+
+RTPSender::RTPSender() {
+  init();
+}
+
+void RTPSender::init() {
+  reset();
+  m_TcpTransport = false;
+  m_tcpFd = -1;
+  m_control = NULL;
+  m_udpSocket = NULL;
+  m_rtcpSocket = NULL;
+  m_packetCount = 0;
+  m_octetCount = 0;
+  m_lastReportMsec = 0;
+  memset(&m_rtcpStats, 0, sizeof(m_rtcpStats));
+  m_prevMsec = 0;
+  m_paused = false;
+  m_SequenceNumber = 0;
+  m_Timestamp = 0;
+  m_ssrc = rand();  // every destination streams with its own SSRC
+  m_needKeyframe = true;  // a new viewer starts on an IDR picture
+  m_framesSent = 0;
+  m_framesDropped = 0;
+  m_sendErrors = 0;
+  m_bytesSent = 0;
+  m_shortWrites = 0;
+  m_latency.clear();
+}
+
+SessionStats RTPSender::getStats() {
+  SessionStats stats;
+  stats.packets = m_packetCount;
+  stats.bytes = m_bytesSent;
+  stats.sendErrors = m_sendErrors;
+  stats.shortWrites = m_shortWrites;
+  stats.framesSent = m_framesSent;
+  stats.framesDropped = m_framesDropped;
+  m_latency.get(stats.latency);
+  return stats;
+}
+
+RTPSender::~RTPSender() {
+  reset();
+}
+
+void RTPSender::setTcp(TCPSocket* socket, int packetSize, int sendChunk) {
+  m_TcpTransport = true;
+  m_control = socket;
+  m_tcpFd = socket->fd();
+  m_packetSize = packetSize;
+  m_sendChunk = sendChunk;
+}
+
+void RTPSender::setUdp(UDPSocket* socket, IPAddress ip, uint16_t port, int mtu) {
+  m_TcpTransport = false;
+  m_packetSize = mtu - 28;  // IPv4 and UDP headers
+  m_sendChunk = 0;
+  m_udpSocket = socket;
+  m_destIP = ip;
+  m_destPort = port;
+}
+
+void RTPSender::setRtcpUdp(UDPSocket* socket, uint16_t port) {
+  m_rtcpSocket = socket;
+  m_rtcpPort = port;
+}
+
+static void ntpTime(uint32_t* sec, uint32_t* frac) {
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  *sec = tv.tv_sec + 2208988800UL;  // NTP counts from 1900
+  *frac = (uint32_t)(((uint64_t)tv.tv_usec << 32) / 1000000);
+}
+
+static void put32(uint8_t* p, uint32_t v) {
+  p[0] = v >> 24;
+  p[1] = v >> 16;
+  p[2] = v >> 8;
+  p[3] = v;
+}
+
+static uint32_t get32(const uint8_t* p) {
+  return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+// Compound SR + SDES CNAME every RTCP_SR_INTERVAL_MS. The SR maps the 90kHz RTP clock
+// to wallclock. Returns false if it has to wait, TCP can't interrupt a half-written packet.
+bool RTPSender::sendReport(uint32_t now) {
+  if (m_paused || (m_framesSent == 0 && !m_current.slot) || now - m_lastReportMsec < RTCP_SR_INTERVAL_MS) {
+    return true;
+  }
+  if (m_TcpTransport ? m_txOffset > 0 : !m_rtcpSocket) {
+    return false;
+  }
+  m_lastReportMsec = now;
+
+  uint8_t report[KRtpPrefixSize + 28 + 12 + sizeof(RTCP_CNAME) + 3];
+  uint8_t* p = report + KRtpPrefixSize;
+  uint32_t ntpSec, ntpFrac;
+  ntpTime(&ntpSec, &ntpFrac);
+
+  p[0] = 0x80;  // version 2, no report blocks
+  p[1] = 200;   // SR
+  p[2] = 0;
+  p[3] = 6;     // length in 32 bit words - 1
+  put32(p + 4, m_ssrc);
+  put32(p + 8, ntpSec);
+  put32(p + 12, ntpFrac);
+  put32(p + 16, getRtpTime(now));  // RTP time of this wallclock instant
+  put32(p + 20, m_packetCount);
+  put32(p + 24, m_octetCount);
+  p += 28;
+
+  int cnameLen = sizeof(RTCP_CNAME) - 1;
+  int sdesLen = (8 + 2 + cnameLen + 1 + 3) & ~3;  // chunk is null terminated and padded to 32 bits
+  memset(p, 0, sdesLen);
+  p[0] = 0x81;  // version 2, one chunk
+  p[1] = 202;   // SDES
+  p[2] = 0;
+  p[3] = sdesLen / 4 - 1;
+  put32(p + 4, m_ssrc);
+  p[8] = 1;     // CNAME
+  p[9] = cnameLen;
+  memcpy(p + 10, RTCP_CNAME, cnameLen);
+  p += sdesLen;
+
+  int len = p - report - KRtpPrefixSize;
+  if (m_TcpTransport) {
+    report[0] = '$';
+    report[1] = 1;  // RTCP channel
+    report[2] = len >> 8;
+    report[3] = len & 0xFF;
+    return m_control->write((const char*)report, len + KRtpPrefixSize) > 0;  // goes out with the replies
+  } else {
+    struct iovec iov = { report + KRtpPrefixSize, (size_t)len };
+    m_rtcpSocket->sendv(&iov, 1, m_destIP, m_rtcpPort);
+    return true;
+  }
+}
+
+// walk a compound RTCP packet and pick the report block about our SSRC
+void RTPSender::handleRtcp(const uint8_t* data, int len) {
+  while (len >= 8) {
+    if ((data[0] & 0xC0) != 0x80) {  // not version 2
+      return;
+    }
+    int count = data[0] & 0x1F;
+    int type = data[1];
+    int pktLen = ((data[2] << 8) | data[3]) * 4 + 4;
+    if (pktLen > len) {
+      return;
+    }
+
+    const uint8_t* block = NULL;
+    if (type == 201) {  // RR
+      block = data + 8;
+    } else if (type == 200) {  // SR, report blocks follow the sender info
+      block = data + 28;
+    }
+    for (int i = 0; block && i < count && block + 24 <= data + pktLen; i++, block += 24) {
+      if (get32(block) != m_ssrc) {
+        continue;
+      }
+      uint32_t now = millis();
+      m_rtcpStats.fractionLost = block[4];
+      int32_t lost = ((int32_t)block[5] << 16) | (block[6] << 8) | block[7];
+      if (lost & 0x800000) {  // 24 bit signed
+        lost |= 0xFF000000;
+      }
+      m_rtcpStats.cumulativeLost = lost;
+      m_rtcpStats.highestSeq = get32(block + 8);
+      m_rtcpStats.jitter = get32(block + 12);
+      uint32_t lsr = get32(block + 16);
+      uint32_t dlsr = get32(block + 20);
+      if (lsr != 0) {  // RTT = arrival - LSR - DLSR, in 1/65536 seconds
+        uint32_t ntpSec, ntpFrac;
+        ntpTime(&ntpSec, &ntpFrac);
+        uint32_t arrival = (ntpSec << 16) | (ntpFrac >> 16);
+        uint32_t rtt = arrival - lsr - dlsr;
+        m_rtcpStats.rttMs = (uint32_t)(((uint64_t)rtt * 1000) >> 16);
+      }
+      m_rtcpStats.lastReportMsec = now ? now : 1;
+    }
+
+    data += pktLen;
+    len -= pktLen;
+  }
+}
+
+// cut the next packets of the current frame, as many as fit into one send chunk
+void RTPSender::buildBatch() {
+  RTPFrame* frame = m_current.rtp;
+  char* header = m_batchHdr;
+  m_batchCount = 0;
+  m_batchBytes = 0;
+  m_txOffset = 0;
+  while (m_batchCount < RTP_MAX_BATCH && m_fragmentOffset < frame->getLength()) {
+    RTPPacket* packet = &m_batch[m_batchCount++];
+    packet->header = header;
+    packet->headerLen = frame->buildHeader(&m_fragmentOffset, m_packetSize, m_SequenceNumber, m_Timestamp, m_ssrc, header, &packet->payload, &packet->payloadLen);
+    header += packet->headerLen;
+    m_batchBytes += packet->headerLen + packet->payloadLen;
+
+    m_SequenceNumber++;
+    m_packetCount++;
+    m_octetCount += packet->headerLen - KRtpPrefixSize - KRtpHeaderSize + packet->payloadLen;
+
+    if (m_TcpTransport && m_batchBytes + KRtpPrefixSize + m_packetSize > m_sendChunk) {
+      break;  // the next packet wouldn't fit
+    }
+  }
+}
+
+// 1 once the batch has gone out completely, 0 if the socket is full, -1 if broken
+int RTPSender::sendBatch() {
+  struct iovec iov[2 * RTP_MAX_BATCH];
+  if (!m_TcpTransport) {
+    if (!m_udpSocket) {  // PLAY without SETUP
+      return -1;
+    }
+    uint32_t bytes;
+    m_sendErrors += m_udpSocket->sendBatch(m_batch, m_batchCount, m_destIP, m_destPort, &bytes);  // a failed datagram is just a lost packet
+    m_bytesSent += bytes;
+    return 1;
+  }
+
+  for (int i = 0; i < m_batchCount; i++) {
+    iov[2 * i].iov_base = m_batch[i].header;
+    iov[2 * i].iov_len = m_batch[i].headerLen;
+    iov[2 * i + 1].iov_base = (void*)m_batch[i].payload;
+    iov[2 * i + 1].iov_len = m_batch[i].payloadLen;
+  }
+  struct iovec* iovp = iov;
+  int iovcnt = 2 * m_batchCount;
+  advanceIov(&iovp, &iovcnt, m_txOffset);
+
+  struct msghdr msg;
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = iovp;
+  msg.msg_iovlen = iovcnt;
+  int res = sendmsg(m_tcpFd, &msg, MSG_DONTWAIT);
+  if (res < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+    m_blocked = true;
+    m_shortWrites++;
+    return 0;
+  }
+  if (res < 0) {
+    m_sendErrors++;
+    return -1;
+  }
+  m_txOffset += res;
+  m_bytesSent += res;
+  m_blocked = m_txOffset < m_batchBytes;
+  if (m_blocked) {
+    m_shortWrites++;
+  }
+  return m_blocked ? 0 : 1;
+}
+
+void RTPSender::releaseFrame(SessionFrame* frame) {
+  if (frame->slot) {
+    m_frameRing->release(frame->slot);
+    frame->slot = NULL;
+    frame->rtp = NULL;
+  }
+}
+
+void RTPSender::reset() {
+  releaseFrame(&m_current);
+  releaseFrame(&m_pending);
+  m_batchCount = 0;
+  m_txOffset = 0;
+  m_blocked = false;
+}
+
+void RTPSender::pause(uint32_t now) {
+  if (m_TcpTransport && m_txOffset > 0) {
+    // a half written batch still has to go out whole, then the frame ends
+    releaseFrame(&m_pending);
+    m_fragmentOffset = m_current.rtp->getLength();
+  } else {
+    reset();
+  }
+  m_pauseMsec = now;
+  m_paused = true;
+}
+
+// the paused time is cut out of the RTP clock, the next frame follows the last one sent
+void RTPSender::resume(uint32_t now) {
+  m_prevMsec += now - m_pauseMsec;
+  m_paused = false;
+  m_needKeyframe = true;  // the frames of the pause were never sent
+}
+
+uint32_t RTPSender::getRtpTime(uint32_t now) {
+  if (m_framesSent == 0 && m_framesDropped == 0) {
+    return m_Timestamp;  // the first frame starts the clock
+  }
+  return m_Timestamp + 90 * ((m_paused ? m_pauseMsec : now) - m_prevMsec);
+}
+
+void RTPSender::enqueueFrame(FrameRing* ring, FrameSlot* slot, RTPFrame* frame) {
+  m_frameRing = ring;
+  uint32_t seq = slot->seq.load(std::memory_order_relaxed);
+  if (seq != m_nextFrameSeq) {
+    m_needKeyframe = true;  // frames went missing before they got here
+  }
+  m_nextFrameSeq = seq + 1;
+  if (m_needKeyframe && !frame->isKeyframe()) {
+    return;  // not counted, only drops of the queue tell the quality controller about congestion
+  }
+  if (m_pending.slot) {
+    if (!frame->isKeyframe()) {
+      // H.264 decodes in order, the waiting picture goes out and this one is skipped
+      m_needKeyframe = true;
+      m_framesDropped++;
+      return;
+    }
+    releaseFrame(&m_pending);  // latest frame wins, the one still waiting is skipped as a whole
+    m_framesDropped++;
+  }
+  m_needKeyframe = false;
+  ring->addRef(slot);
+  m_pending.slot = slot;
+  m_pending.rtp = frame;
+
+  if (!m_current.slot) {
+    m_current = m_pending;
+    m_pending.slot = NULL;
+    beginFrame();
+  }
+}
+
+void RTPSender::beginFrame() {
+  m_fragmentOffset = 0;
+  m_batchCount = 0;
+  m_txOffset = 0;
+
+  // each image gets a timestamp from its capture time
+  uint32_t msec = m_current.slot->msec;
+  if ((m_framesSent > 0 || m_framesDropped > 0) && (int32_t)(msec - m_prevMsec) > 0) {
+    m_Timestamp += 90 * (msec - m_prevMsec);  // 90kHz clock, unsigned math handles millis() rollover
+  }
+  m_prevMsec = msec;
+}
+
+void RTPSender::nextBatch() {
+  m_batchCount = 0;
+  m_txOffset = 0;
+  if (m_fragmentOffset < m_current.rtp->getLength()) {
+    return;
+  }
+
+  // whole frame sent, continue with the waiting one
+  m_latency.add(millis() - m_current.slot->msec);
+  releaseFrame(&m_current);
+  m_framesSent++;
+  if (m_pending.slot) {
+    m_current = m_pending;
+    m_pending.slot = NULL;
+    beginFrame();
+  }
+}
+
+// Send as much of the queue as the socket takes without blocking. Over TCP the queued
+// replies and reports go first whenever no batch is half written, they never split a packet.
+bool RTPSender::flush() {
+  while (true) {
+    if (m_control && m_txOffset == 0) {
+      int res = m_control->flush();
+      if (res < 0) {
+        return false;
+      }
+      m_blocked = res == 0;
+      if (m_blocked) {
+        return true;
+      }
+    }
+    if (!m_current.slot) {
+      return true;
+    }
+    if (m_batchCount == 0) {
+      buildBatch();
+    }
+    int res = sendBatch();
+    if (res <= 0) {
+      return res == 0;
+    }
+    nextBatch();
+  }
+}
+
+void RTSPSession::enqueueFrame(FrameRing* ring, FrameSlot* slot, RTPFrame* frame) {
+  m_rtp.enqueueFrame(ring, slot, frame);
+}
+
+// feedback for the quality controller since the previous sample
+QualitySample RTSPSession::takeQualitySample() {
+  QualitySample sample;
+  const RTCPStats& stats = m_rtp.getRtcpStats();
+  sample.queueDepth = m_rtp.getQueueDepth();
+  sample.drops = m_rtp.getFramesDropped() - m_sampleDrops;
+  sample.sendErrors = m_rtp.getSendErrors() - m_sampleErrors;
+  sample.fractionLost = stats.lastReportMsec != m_sampleReportMsec ? stats.fractionLost : -1;  // each report counts once
+  m_sampleDrops = m_rtp.getFramesDropped();
+  m_sampleErrors = m_rtp.getSendErrors();
+  m_sampleReportMsec = stats.lastReportMsec;
+  return sample;
+}
+
+// RTP of a streaming unicast session, and the replies waiting for any session
+void RTSPSession::flush() {
+  bool ok;
+  if (m_rtp.isTcp()) {
+    ok = m_rtp.flush();  // interleaves the replies
+  } else {
+    ok = m_tcpClient.flush() >= 0;
+    if (ok && m_status == SessionStatus::STATUS_STREAMING && !m_multicast) {
+      ok = m_rtp.flush();
+    }
+  }
+  if (!ok) {
+    m_status = SessionStatus::STATUS_ERROR;
+    return;
+  }
+  if (m_status == SessionStatus::STATUS_STREAMING && !m_multicast) {
+    m_rtp.sendReport(millis());
+  }
+}
+
+RTSPSession::RTSPSession() {
+  m_status = SessionStatus::STATUS_UNINIT;
+}
+
+void RTSPSession::open(int fd, EasyRTSPServer* server) {
+  m_tcpClient.attach(fd);
+  m_server = server;
+  m_streamInfo = server->getStreamInfo();
+  m_mountLocked = false;
   m_status = SessionStatus::STATUS_UNINIT;
-  sprintf(m_clientIP, "%s", m_tcpClient->remoteIP().toString());
-  m_clientIPAddr = m_tcpClient->remoteIP();
+  m_lastActivityMsec = millis();
+  m_parser.reset();
+  m_TcpTransport = false;
+  m_multicast = false;
+  m_sampleDrops = 0;
+  m_sampleErrors = 0;
+  m_sampleReportMsec = 0;
+  m_rtp.init();
+  sprintf(m_clientIP, "%s", m_tcpClient.remoteIP().toString().c_str());
+  m_clientIPAddr = m_tcpClient.remoteIP();
   if (strlen(m_streamInfo->m_authStr) == 0) {
     m_authed = true;
   } else {
@@ -102,58 +1005,84 @@ RTSPSession::RTSPSession(WiFiClient* client, StreamInfo* streamInfo) {
 }
 
 RTSPSession::~RTSPSession() {
+  close();
+}
+
+void RTSPSession::close() {
+  if (!m_rtp.isMidBatch()) {
+    m_tcpClient.flush();  // the last reply, TEARDOWN or an error, if the socket takes it right away
+  }
+  m_rtp.reset();  // give queued frames back to the ring
   m_rtpSocket.stop();
-  m_tcpClient->stop();
+  m_rtcpSocket.stop();
+  m_tcpClient.stop();
+  m_status = SessionStatus::STATUS_CLOSED;
 }
 
-void RTSPSession::Handle_RtspOPTION(WiFiClient* client) {
+void RTSPSession::Handle_RtspOPTION(TCPSocket* client) {
   int l = snprintf(buf, sizeof(buf),
                    "RTSP/1.0 200 OK\r\nCSeq: %u\r\n"
-                   "Public: DESCRIBE, SETUP, TEARDOWN, PLAY, PAUSE\r\n\r\n",
+                   "Public: DESCRIBE, SETUP, TEARDOWN, PLAY, PAUSE, GET_PARAMETER\r\n\r\n",
                    m_CSeq);
   client->write(buf, l);
 }
 
-void RTSPSession::Handle_RtspDESCRIBE(WiFiClient* client) {
-  char SDPBuf[256] = { 0 };
+void RTSPSession::Handle_RtspDESCRIBE(TCPSocket* client) {
+  char SDPBuf[448] = { 0 };
+  char media[256];
+  char connection[32] = "0.0.0.0";
   int l;
+  int sdpLen = 0;
 
   if (!m_authed) {
-    l = snprintf(buf, sizeof(buf),
-                 "RTSP/1.0 401 Unauthorized\r\nCSeq: %u\r\n"
-                 "WWW-Authenticate: Basic realm=\"EasyRTSPServer\"\r\n"
-                 "%s\r\n\r\n",
-                 m_CSeq,
-                 DateHeader());
+    Handle_RtspUnauthorized(client);
+    return;
   } else {
-    snprintf(SDPBuf, sizeof(SDPBuf),
-             "v=0\r\n"
-             "o=- %d 1 IN IP4 %s\r\n"
-             "s=\r\n"
-             "t=0 0\r\n"                 // start / stop - 0 -> unbounded and permanent session
-             "m=video 0 RTP/AVP 26\r\n"  // currently we just handle UDP sessions
-             "a=x-dimensions: 640,480\r\n"
-             "a=x-control: trackID=1\r\n"
-             "c=IN IP4 0.0.0.0\r\n",
-             rand(),
-             m_streamInfo->m_serverIP);
+    if (strlen(m_streamInfo->m_mcastIP) > 0) {  // advertise the group, unicast clients still get unicast in SETUP
+      snprintf(connection, sizeof(connection), "%s/%d", m_streamInfo->m_mcastIP, m_streamInfo->m_mcastTTL);
+    }
+    int port = strlen(m_streamInfo->m_mcastIP) > 0 ? m_streamInfo->m_mcastPort : 0;  // only meaningful for the multicast group
+    if (m_streamInfo->m_codec == CODEC_H264) {
+      snprintf(media, sizeof(media),
+               "m=video %d RTP/AVP %d\r\n"
+               "a=rtpmap:%d H264/90000\r\n"
+               "a=fmtp:%d packetization-mode=1%s\r\n",
+               port, RTP_PAYLOAD_TYPE_H264, RTP_PAYLOAD_TYPE_H264, RTP_PAYLOAD_TYPE_H264, m_streamInfo->m_h264Fmtp);
+    } else {
+      snprintf(media, sizeof(media), "m=video %d RTP/AVP 26\r\n", port);
+    }
+    sdpLen = snprintf(SDPBuf, sizeof(SDPBuf),
+                      "v=0\r\n"
+                      "o=- %d 1 IN IP4 %s\r\n"
+                      "s=\r\n"
+                      "t=0 0\r\n"  // start / stop - 0 -> unbounded and permanent session
+                      "%s"
+                      "a=x-dimensions: 640,480\r\n"
+                      "a=x-control: trackID=1\r\n"
+                      "c=IN IP4 %s\r\n",
+                      rand(),
+                      m_streamInfo->m_serverIP,
+                      media,
+                      connection);
+    sdpLen = min(sdpLen, (int)sizeof(SDPBuf) - 1);
 
     l = snprintf(buf, sizeof(buf),
                      "RTSP/1.0 200 OK\r\nCSeq: %u\r\n"
                      "Content-Base: %s\r\n"
                      "Content-Type: application/sdp\r\n"
-                     "Content-Length: %d\r\n\r\n"
-                     "%s",
+                     "Content-Length: %d\r\n\r\n",
                      m_CSeq,
                      m_streamInfo->m_rtspURL,
-                     (int)strlen(SDPBuf),
-                     SDPBuf);
+                     sdpLen);
   }
 
   client->write(buf, l);
+  if (sdpLen > 0) {
+    client->write(SDPBuf, sdpLen);  // an H.264 SDP with parameter sets doesn't fit into buf
+  }
 }
 
-void RTSPSession::Handle_RtspSETUP(WiFiClient* client) {
+void RTSPSession::Handle_RtspSETUP(TCPSocket* client) {
   char Transport[256] = { 0 };
 
   m_RtspSessionID = abs(rand());  // create a session ID
@@ -163,6 +1092,15 @@ void RTSPSession::Handle_RtspSETUP(WiFiClient* client) {
   // simulate SETUP server response
   if (m_TcpTransport) {
     snprintf(Transport, sizeof(Transport), "RTP/AVP/TCP;unicast;interleaved=0-1");
+    m_rtp.setTcp(&m_tcpClient, m_streamInfo->m_tcpPacketSize, m_streamInfo->m_tcpSendChunk);
+  } else if (m_multicast) {
+    snprintf(Transport, sizeof(Transport),
+             "RTP/AVP;multicast;destination=%s;source=%s;port=%i-%i;ttl=%i",
+             m_streamInfo->m_mcastIP,
+             m_streamInfo->m_serverIP,
+             m_streamInfo->m_mcastPort,
+             m_streamInfo->m_mcastPort + 1,
+             m_streamInfo->m_mcastTTL);
   } else {
     snprintf(Transport, sizeof(Transport),
              "RTP/AVP;unicast;destination=%s;source=%s;client_port=%i-%i;server_port=%i-%i",
@@ -173,37 +1111,70 @@ void RTSPSession::Handle_RtspSETUP(WiFiClient* client) {
              m_RtpServerPort,
              m_RtcpServerPort);
     m_rtpSocket.begin(m_RtpServerPort);
+    m_rtcpSocket.begin(m_RtcpServerPort);
+    m_rtp.setUdp(&m_rtpSocket, m_clientIPAddr, m_RtpClientPort, m_streamInfo->m_udpMtu);
+    m_rtp.setRtcpUdp(&m_rtcpSocket, m_RtcpClientPort);
   }
 
   int l = snprintf(buf, sizeof(buf),
                    "RTSP/1.0 200 OK\r\nCSeq: %u\r\n"
-                   "Session: %i;timeout=60\r\n"
+                   "Session: %i;timeout=%d\r\n"
                    "Transport: %s\r\n"
                    "%s\r\n\r\n",
                    m_CSeq,
                    m_RtspSessionID,
+                   RTSP_SESSION_TIMEOUT_SEC,
                    Transport,
                    DateHeader());
 
   client->write(buf, l);
 }
 
-void RTSPSession::Handle_RtspPLAY(WiFiClient* client) {
+void RTSPSession::Handle_RtspPLAY(TCPSocket* client) {
+  uint32_t now = millis();
+  if (m_status == SessionStatus::STATUS_PAUSED) {
+    m_rtp.resume(now);
+  }
+  // where the stream continues, multicast sessions join the group's stream as it is
+  char rtpInfo[LEN_MAX_URL + 64] = "";
+  if (!m_multicast) {
+    snprintf(rtpInfo, sizeof(rtpInfo), "RTP-Info: url=%s/trackID=1;seq=%u;rtptime=%u\r\n",
+             m_streamInfo->m_rtspURL, m_rtp.getNextSeq(), (unsigned)m_rtp.getRtpTime(now));
+  }
   int l = snprintf(buf, sizeof(buf),
                    "RTSP/1.0 200 OK\r\nCSeq: %u\r\n"
                    "%s\r\n"
                    "Range: npt=0.000-\r\n"
-                   "Session: %i;timeout=60\r\n"
-                   "RTP-Info: url=%s/trackID=1;seq=0;rtptime=0\r\n\r\n",  // FIXME
+                   "Session: %i;timeout=%d\r\n"
+                   "%s\r\n",
                    m_CSeq,
-                   m_streamInfo->m_rtspURL,
+                   DateHeader(),
                    m_RtspSessionID,
-                   DateHeader());
+                   RTSP_SESSION_TIMEOUT_SEC,
+                   rtpInfo);
 
   client->write(buf, l);
 }
 
-void RTSPSession::Handle_RtspTEARDOWN(WiFiClient* client) {
+// Stops RTP at once, the frames still queued are dropped. The session keeps its
+// transport and sequence numbers, a later PLAY resumes it.
+void RTSPSession::Handle_RtspPAUSE(TCPSocket* client) {
+  if (m_status == SessionStatus::STATUS_STREAMING) {
+    m_rtp.pause(millis());
+  }
+  int l = snprintf(buf, sizeof(buf),
+                   "RTSP/1.0 200 OK\r\nCSeq: %u\r\n"
+                   "%s\r\n"
+                   "Session: %i;timeout=%d\r\n\r\n",
+                   m_CSeq,
+                   DateHeader(),
+                   m_RtspSessionID,
+                   RTSP_SESSION_TIMEOUT_SEC);
+
+  client->write(buf, l);
+}
+
+void RTSPSession::Handle_RtspTEARDOWN(TCPSocket* client) {
   int l = snprintf(buf, sizeof(buf),
                    "RTSP/1.0 200 OK\r\nCSeq: %u\r\n\r\n",
                    m_CSeq);
@@ -211,42 +1182,58 @@ void RTSPSession::Handle_RtspTEARDOWN(WiFiClient* client) {
   client->write(buf, l);
 }
 
-bool RTSPSession::checkURL(char* aRequest) {
-  if (strstr(aRequest, m_streamInfo->m_rtspURL)) {
-    return true;
-  } else {
-    return false;
-  }
-}
+static const char* const KMethodNames[] = { "OPTIONS", "DESCRIBE", "SETUP", "PLAY", "TEARDOWN", "GET_PARAMETER", "PAUSE", "UNKNOWN" };
 
-bool RTSPSession::parseCSeq(char* aRequest, unsigned& seq) {
-  char* ptr = strstr(aRequest, "CSeq:");
-  if (!ptr) {
-    return false;
+// Without a body it is the keepalive of most clients. Asking for "stats" returns the
+// counters of the stream and of every session playing it, with the same credentials as
+// DESCRIBE. The stats are formatted straight into the reply queue of the session.
+void RTSPSession::Handle_RtspGET_PARAMETER(const RTSPRequest& request, TCPSocket* client) {
+  if (request.body.empty()) {
+    int l = snprintf(buf, sizeof(buf), "RTSP/1.0 200 OK\r\nCSeq: %u\r\n%s\r\n\r\n", m_CSeq, DateHeader());
+    client->write(buf, l);
+    return;
   }
-  ptr += 5;
-  while (!isDigit(*ptr)) {
-    ptr++;
-    if (*ptr == '\r') {
-      return false;
-    }
+  if (!request.body.contains("stats")) {
+    int l = snprintf(buf, sizeof(buf), "RTSP/1.0 451 Parameter Not Understood\r\nCSeq: %u\r\n\r\n", m_CSeq);
+    client->write(buf, l);
+    return;
   }
 
-  seq = atoi(ptr);
-  return true;
+  if (!m_authed && !request.authorization.contains(m_streamInfo->m_authStr)) {
+    Handle_RtspUnauthorized(client);
+    return;
+  }
+
+  // leave room for the header in front, it needs the length of the stats
+  size_t room;
+  char* out = client->reserve(&room);
+  int size = room > sizeof(buf) ? min(room - sizeof(buf), (size_t)RTSP_STATS_BUFFER_SIZE) : 0;
+  int len = m_server->formatStats(m_streamInfo, out, size);
+  int l = snprintf(buf, sizeof(buf),
+                   "RTSP/1.0 200 OK\r\nCSeq: %u\r\n"
+                   "Content-Type: text/parameters\r\n"
+                   "Content-Length: %d\r\n\r\n",
+                   m_CSeq,
+                   len);
+  if (len == 0) {
+    client->write(buf, l);
+    return;
+  }
+  memmove(out + l, out, len);
+  memcpy(out, buf, l);
+  client->commit(l + len);
 }
 
-bool RTSPSession::ParseOptionRequest(char* aRequest) {
-  /*
-  OPTIONS rtsp://192.168.1.102:8554/mjpeg/1 RTSP/1.0\r\n
-  CSeq: 0\r\n
-  User-Agent: LibVLC/2.2.8 (LIVE555 Streaming Media v2016.02.22)\r\n
-  \r\n
-  */
+bool RTSPSession::checkURL(const RTSPRequest& request) {
+  StreamInfo* streamInfo = m_server->findStream(request.uri.ptr, request.uri.len);
+  if (!streamInfo || (m_mountLocked && streamInfo != m_streamInfo)) {
+    return false;
+  }
+  m_streamInfo = streamInfo;
   return true;
 }
 
-bool RTSPSession::ParseDescribeRequest(char* aRequest) {
+bool RTSPSession::ParseDescribeRequest(const RTSPRequest& request) {
   /*
   DESCRIBE rtsp://192.168.1.102:8554/mjpeg/1 RTSP/1.0\r\n
   CSeq: 1\r\n
@@ -254,19 +1241,15 @@ bool RTSPSession::ParseDescribeRequest(char* aRequest) {
   Accept: application/sdp\r\n
   \r\n
   */
-  if (!strstr(aRequest, "application/sdp")) {
+  if (!request.accept.empty() && !request.accept.contains("application/sdp")) {
     return false;
   }
 
-  if (strstr(aRequest, m_streamInfo->m_authStr)) {
-    m_authed = true;
-  } else {
-    m_authed = false;
-  }
+  m_authed = strlen(m_streamInfo->m_authStr) == 0 || request.authorization.contains(m_streamInfo->m_authStr);
   return true;
 }
 
-bool RTSPSession::ParseSetupRequest(char* aRequest) {
+bool RTSPSession::ParseSetupRequest(const RTSPRequest& request) {
   /*
   SETUP rtsp://192.168.1.102:8554/mjpeg/1 RTSP/1.0\r\n
   CSeq: 3\r\n
@@ -283,121 +1266,60 @@ bool RTSPSession::ParseSetupRequest(char* aRequest) {
   \r\n
   */
 
-  char* ptr = strstr(aRequest, "Transport:");
-  if (!ptr) {
+  // nothing carries over from an earlier SETUP, rejected or not
+  m_TcpTransport = false;
+  m_multicast = false;
+
+  const RTSPSlice& transport = request.transport;
+  if (transport.empty()) {
     return false;
   }
-  ptr += 10;
 
-  if (strstr(ptr, "RTP/AVP/TCP")) {
+  if (transport.contains("RTP/AVP/TCP")) {
     m_TcpTransport = true;
   } else {
-    m_TcpTransport = false;
-    ptr = strstr(ptr, "client_port=");
+    if (transport.contains("multicast")) {  // the group/port/ttl are ours to choose
+      m_multicast = true;
+      return true;
+    }
+    const char* ptr = transport.find("client_port=");
     if (!ptr) {
       return false;
     }
-    ptr += 12;
-    while (!isDigit(*ptr)) {
-      ptr++;
-      if (*ptr == '\r') {
-        return false;
-      }
+    RTSPSlice port;
+    port.ptr = ptr + 12;
+    port.len = transport.ptr + transport.len - port.ptr;
+    m_RtpClientPort = port.toUInt();
+    if (m_RtpClientPort == 0) {
+      return false;
     }
-    m_RtpClientPort = atoi(ptr);
     m_RtcpClientPort = m_RtpClientPort + 1;
   }
 
   return true;
 }
 
-bool RTSPSession::ParsePlayRequest(char* aRequest) {
-  /*
-  PLAY rtsp://192.168.1.102:8554/mjpeg/1 RTSP/1.0\r\n
-  CSeq: 4\r\n
-  Session: 66334873\r\n
-  Range: npt=0.000-\r\n
-  \r\n
-  */
-  return true;
-}
-
-bool RTSPSession::ParseTeardownRequest(char* aRequest) {
-  /*
-  TEARDOWN rtsp://192.168.1.102:8554/mjpeg/1 RTSP/1.0\r\n
-  CSeq: 5\r\n
-  Session: 66334873\r\n
-  \r\n
-  */
-  return true;
-}
-
+// straight from the socket into the parser, WiFiClient would keep read-ahead the reactor can't see
 RecvResult RTSPSession::recv_RTSPRequest() {
-  int len = m_tcpClient->available();
-  if (len) {
-    if (m_bufPos == 0 || m_bufPos >= sizeof(buf) - 256)  // in case of bad client
-    {
-      memset(buf, 0x00, sizeof(buf));
-      m_bufPos = 0;
-      m_recvStatus = hdrStateUnknown;
-    }
-  }
-  while (len) {
-    len = m_tcpClient->readBytes(&buf[m_bufPos], len);
-    m_bufPos += len;
-    len = m_tcpClient->available();
-  }
-
-  if (m_bufPos > 0) {
-    Serial.printf("Read %d bytes: %s\n", m_bufPos, buf);
-    if (m_recvStatus == hdrStateUnknown && m_bufPos >= 6)  // we need at least 4-letter at the line start with optional heading CRLF
-    {
-      if (NULL != strstr(buf, "\r\n"))  // got a full line
-      {
-        char* s = buf;
-        if (*s == '\r' && *(s + 1) == '\n')  // skip allowed empty line at front
-          s += 2;
-
-        // find out the command type
-        m_RtspCmdType = RTSP_UNKNOWN;
-
-        if (strncmp(s, "OPTIONS ", 8) == 0) m_RtspCmdType = RTSP_OPTIONS;
-        else if (strncmp(s, "DESCRIBE ", 9) == 0) m_RtspCmdType = RTSP_DESCRIBE;
-        else if (strncmp(s, "SETUP ", 6) == 0) m_RtspCmdType = RTSP_SETUP;
-        else if (strncmp(s, "PLAY ", 5) == 0) m_RtspCmdType = RTSP_PLAY;
-        else if (strncmp(s, "TEARDOWN ", 9) == 0) m_RtspCmdType = RTSP_TEARDOWN;
-
-        if (m_RtspCmdType != RTSP_UNKNOWN)  // got some
-          m_recvStatus = hdrStateGotMethod;
-        else
-          m_recvStatus = hdrStateInvalid;
-      }
-    }
-
-    if (m_recvStatus == hdrStateUnknown) {  // if state == hdrStateUnknown when bufPos<6 or find on \r\n, need continue read
-      return RecvResult::RECV_CONTINUE;
+  while (true) {
+    uint32_t space;
+    char* p = m_parser.writeBuffer(&space);
+    if (space == 0) {
+      break;  // parse first, the reactor calls again while there is more
     }
-
-    if (m_recvStatus == hdrStateInvalid)  // read a line but find no RTSP method, bad request
-    {
-      m_bufPos = 0;
-      return RecvResult::RECV_BAD_REQUEST;
+    int len = recv(m_tcpClient.fd(), p, space, MSG_DONTWAIT);
+    if (len == 0 || (len < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) {
+      return RecvResult::RECV_CLOSED;
     }
-
-    // per https://tools.ietf.org/html/rfc2326 we need to look for an empty line
-    // to be sure that we got the correctly formed header. Also starting CRLF should be ignored.
-    char* s = strstr(m_bufPos > 4 ? buf + m_bufPos - 4 : buf, "\r\n\r\n");  // try to save cycles by searching in the new data only
-    if (s == NULL) {                                                        // no end of header seen yet, need continue read
-      return RecvResult::RECV_CONTINUE;
-    } else {
-      return RecvResult::RECV_FULL_REQUEST;
+    if (len < 0) {
+      break;
     }
-  } else {
-    return RecvResult::RECV_CONTINUE;
+    m_parser.commit(len);
   }
+  return RecvResult::RECV_CONTINUE;
 }
 
-void RTSPSession::Handle_RtspNotFound(WiFiClient* client) {
+void RTSPSession::Handle_RtspNotFound(TCPSocket* client) {
   int l = snprintf(buf, sizeof(buf),
                    "RTSP/1.0 404 Stream Not Found\r\nCSeq: %u\r\n%s\r\n\r\n",
                    m_CSeq,
@@ -405,28 +1327,59 @@ void RTSPSession::Handle_RtspNotFound(WiFiClient* client) {
   client->write(buf, l);
 }
 
-void RTSPSession::Handle_RtspBadRequest(WiFiClient* client) {
+void RTSPSession::Handle_RtspBadRequest(TCPSocket* client) {
   int l = snprintf(buf, sizeof(buf), "RTSP/1.0 400 Bad Request\r\nCSeq: %u\r\n\r\n", m_CSeq);
   client->write(buf, l);
 }
 
-RTSP_CMD_TYPES RTSPSession::Handle_RtspRequest(char* aRequest, WiFiClient* client) {
-  /* check URL */
-  if (!checkURL(aRequest)) {
-    Handle_RtspNotFound(client);
+void RTSPSession::Handle_RtspNotImplemented(TCPSocket* client) {
+  int l = snprintf(buf, sizeof(buf), "RTSP/1.0 501 Not Implemented\r\nCSeq: %u\r\n\r\n", m_CSeq);
+  client->write(buf, l);
+}
+
+void RTSPSession::Handle_RtspUnsupportedTransport(TCPSocket* client) {
+  int l = snprintf(buf, sizeof(buf), "RTSP/1.0 461 Unsupported Transport\r\nCSeq: %u\r\n\r\n", m_CSeq);
+  client->write(buf, l);
+}
+
+void RTSPSession::Handle_RtspWrongState(TCPSocket* client) {
+  int l = snprintf(buf, sizeof(buf), "RTSP/1.0 455 Method Not Valid in This State\r\nCSeq: %u\r\n\r\n", m_CSeq);
+  client->write(buf, l);
+}
+
+void RTSPSession::Handle_RtspUnauthorized(TCPSocket* client) {
+  int l = snprintf(buf, sizeof(buf),
+                   "RTSP/1.0 401 Unauthorized\r\nCSeq: %u\r\n"
+                   "WWW-Authenticate: Basic realm=\"EasyRTSPServer\"\r\n"
+                   "%s\r\n\r\n",
+                   m_CSeq,
+                   DateHeader());
+  client->write(buf, l);
+}
+
+RTSP_CMD_TYPES RTSPSession::Handle_RtspRequest(const RTSPRequest& request, TCPSocket* client) {
+  RTSP_LOGD("%s %s CSeq %u", KMethodNames[request.method], m_clientIP, request.cseq.toUInt());
+  if (request.cseq.empty()) {
+    Handle_RtspBadRequest(client);
     return RTSP_UNKNOWN;
   }
-  if (!parseCSeq(aRequest, m_CSeq)) {
-    Handle_RtspBadRequest(client);
+  m_CSeq = request.cseq.toUInt();
+  if (request.method == RTSP_UNKNOWN) {
+    Handle_RtspNotImplemented(client);
+    return RTSP_UNKNOWN;
+  }
+  /* check URL */
+  if (!checkURL(request)) {
+    Handle_RtspNotFound(client);
     return RTSP_UNKNOWN;
   }
 
-  switch (m_RtspCmdType) {
+  switch (request.method) {
     case RTSP_OPTIONS:
       Handle_RtspOPTION(client);
       break;
     case RTSP_DESCRIBE:
-      if (ParseDescribeRequest(aRequest)) {
+      if (ParseDescribeRequest(request)) {
         Handle_RtspDESCRIBE(client);
       } else {
         Handle_RtspBadRequest(client);
@@ -434,8 +1387,14 @@ RTSP_CMD_TYPES RTSPSession::Handle_RtspRequest(char* aRequest, WiFiClient* clien
       }
       break;
     case RTSP_SETUP:
-      if (ParseSetupRequest(aRequest)) {
+      if (ParseSetupRequest(request)) {
+        if (m_multicast && strlen(m_streamInfo->m_mcastIP) == 0) {  // multicast is not configured
+          m_multicast = false;
+          Handle_RtspUnsupportedTransport(client);
+          return RTSP_UNKNOWN;
+        }
         Handle_RtspSETUP(client);
+        m_mountLocked = true;
       } else {
         Handle_RtspBadRequest(client);
         return RTSP_UNKNOWN;
@@ -444,91 +1403,89 @@ RTSP_CMD_TYPES RTSPSession::Handle_RtspRequest(char* aRequest, WiFiClient* clien
     case RTSP_PLAY:
       Handle_RtspPLAY(client);
       break;
+    case RTSP_PAUSE:
+      if (m_status != SessionStatus::STATUS_STREAMING && m_status != SessionStatus::STATUS_PAUSED) {
+        Handle_RtspWrongState(client);
+        return RTSP_UNKNOWN;
+      }
+      Handle_RtspPAUSE(client);
+      break;
     case RTSP_TEARDOWN:
       Handle_RtspTEARDOWN(client);
       break;
+    case RTSP_GET_PARAMETER:
+      Handle_RtspGET_PARAMETER(request, client);
+      break;
     default:
       Handle_RtspBadRequest(client);
       return RTSP_UNKNOWN;
       break;
   }
 
-  return m_RtspCmdType;
-}
-
-int RTSPSession::SendRtpPacket(RTPPacket* rtpPcaket) {
-  char* rtpBuf = rtpPcaket->getRtpBufHead();
-  int rtpButLen = rtpPcaket->getRtpPacketSize();
-  int sendlen = 0;
-  if (m_TcpTransport) {
-    sendlen = m_tcpClient->write(rtpBuf, rtpButLen + 4);
-  } else {
-    m_rtpSocket.beginPacket(m_clientIPAddr, m_RtpClientPort);
-    sendlen = m_rtpSocket.write((const unsigned char*)&rtpBuf[4], rtpButLen);
-    m_rtpSocket.endPacket();
-  }
-  return sendlen;
-}
-
-void RTSPSession::streamRTP(RTPPacket* rtpPcaket, uint32_t curMsec) {
-
-  //Serial.printf("curMsec = %d, m_prevMsec = %d\n", curMsec, m_prevMsec);
-
-  rtpPcaket->setRtpHeader(m_SequenceNumber, m_Timestamp);
-  
-  SendRtpPacket(rtpPcaket);
-
-  m_SequenceNumber++;
-  // Increment ONLY after a full frame
-  //Serial.printf("deltams = %d, m_Timestamp = %d\n", deltams, m_Timestamp);
-  if (rtpPcaket->isLastFragment()) {
-    // compute deltat (being careful to handle clock rollover with a little lie)
-    uint32_t deltams = (curMsec >= m_prevMsec) ? curMsec - m_prevMsec : 100;
-    m_prevMsec = curMsec;
-    m_Timestamp += (90000 * deltams / 1000);  // fixed timestamp increment for a frame rate of 25fps
-  }
-  
-  m_SendIdx++;
-  if (m_SendIdx > 1)
-    m_SendIdx = 0;
+  return request.method;
 }
 
+// called by the reactor when the RTSP connection or the RTCP socket is readable
 void RTSPSession::run() {
-  if (m_tcpClient->connected()) {
-    RecvResult result = recv_RTSPRequest();
+  uint8_t rtcp[256];
+  int n;
+  while ((n = m_rtcpSocket.recv(rtcp, sizeof(rtcp))) > 0) {
+    m_rtp.handleRtcp(rtcp, n);
+    m_lastActivityMsec = millis();
+  }
 
-    if (result == RecvResult::RECV_FULL_REQUEST) {
-      // got full header, parse
-      RTSP_CMD_TYPES C = Handle_RtspRequest(buf, m_tcpClient);
+  RecvResult result = recv_RTSPRequest();
+
+  // every complete request in the buffer, pipelined ones included
+  RTSPRequest request;
+  RTSPSlice payload;
+  uint8_t channel;
+  RecvResult parsed;
+  while (m_status < SessionStatus::STATUS_CLOSED && (parsed = m_parser.next(&request, &channel, &payload)) != RecvResult::RECV_CONTINUE) {
+    if (parsed == RecvResult::RECV_INTERLEAVED) {
+      if (channel == 1) {
+        m_rtp.handleRtcp((const uint8_t*)payload.ptr, payload.len);
+        m_lastActivityMsec = millis();
+      }
+    } else if (parsed == RecvResult::RECV_BAD_REQUEST) {
+      Handle_RtspBadRequest(&m_tcpClient);
+      m_status = SessionStatus::STATUS_ERROR;
+    } else {
+      m_lastActivityMsec = millis();  // any request is a keepalive, OPTIONS and GET_PARAMETER included
+      RTSP_CMD_TYPES C = Handle_RtspRequest(request, &m_tcpClient);
 
       if (C == RTSP_PLAY)
         m_status = SessionStatus::STATUS_STREAMING;
 
+      else if (C == RTSP_PAUSE)
+        m_status = SessionStatus::STATUS_PAUSED;  // mounts skip it, capture idles once no session streams
+
       else if (C == RTSP_TEARDOWN)
         m_status = SessionStatus::STATUS_CLOSED;
-
-      //cleaning up
-      m_recvStatus = hdrStateUnknown;
-      m_bufPos = 0;
-    } else if (result == RecvResult::RECV_BAD_REQUEST) {
-      Handle_RtspBadRequest(m_tcpClient);
-      m_status = SessionStatus::STATUS_ERROR;
     }
-  } else {
+  }
+
+  if (result == RecvResult::RECV_CLOSED) {
     m_status = SessionStatus::STATUS_CLOSED;
+  } else if (m_status < SessionStatus::STATUS_CLOSED) {
+    flush();  // the replies right away, unless the socket or a half written batch holds them back
   }
 }
 
-EasyRTSPServer::EasyRTSPServer(uint16_t port) {
-  m_ServerPort = port;
+RTSPMount::RTSPMount() {
   memset(&m_streamInfo, 0, sizeof(m_streamInfo));
-  m_msecPerFrame = 100;
+  m_usecPerFrame = 100000;
+  m_rateChanged = false;
+  m_captureEnabled = false;
+  m_frames = 0;
+  m_fps100 = 0;
+  m_skipped = 0;
+  m_lastLateUsec = 0;
+  m_avgLateUsec = 0;
+  m_maxLateUsec = 0;
 }
 
-EasyRTSPServer::~EasyRTSPServer() {
-}
-
-bool EasyRTSPServer::setStreamSuffix(char* suffix) {
+bool RTSPMount::setSuffix(const char* suffix) {
   memset(m_streamInfo.m_suffix, 0, LEN_MAX_SUFFIX);
   if (strlen(suffix) < LEN_MAX_SUFFIX) {
     strcpy(m_streamInfo.m_suffix, suffix);
@@ -538,13 +1495,126 @@ bool EasyRTSPServer::setStreamSuffix(char* suffix) {
   }
 }
 
-void EasyRTSPServer::setFrameRate(RTSP_FRAMERATE frameRate) {
+void RTSPMount::setFrameRate(RTSP_FRAMERATE frameRate) {
   switch (frameRate) {
-    case FRAMERATE_5HZ: m_msecPerFrame = 200; break;
-    case FRAMERATE_10HZ: m_msecPerFrame = 100; break;
-    case FRAMERATE_20HZ: m_msecPerFrame = 50; break;
-    default: m_msecPerFrame = 100; break;
+    case FRAMERATE_5HZ: setFrameRate(5.0f); break;
+    case FRAMERATE_10HZ: setFrameRate(10.0f); break;
+    case FRAMERATE_20HZ: setFrameRate(20.0f); break;
+    case FRAMERATE_UNLIMITED: setFrameRate(0.0f); break;
+    default: setFrameRate(10.0f); break;
+  }
+}
+
+void RTSPMount::setFrameRate(float fps) {
+  m_usecPerFrame = fps > 0 ? (uint32_t)(1000000.0f / fps) : 0;
+  m_rateChanged = true;  // the quality controller starts over from this rate
+  wakeCapture();  // take the new interval from the next frame on
+}
+
+StreamStats RTSPMount::getStats() {
+  StreamStats stats;
+  stats.frames = m_frames;
+  stats.fps100 = m_fps100;
+  stats.overruns = m_skipped;
+  m_frameSizes.get(stats.frameSize);
+  return stats;
+}
+
+FrameTiming RTSPMount::getFrameTiming() {
+  FrameTiming timing;
+  timing.frames = m_frames;
+  timing.skipped = m_skipped;
+  timing.lastLateUsec = m_lastLateUsec;
+  timing.avgLateUsec = m_avgLateUsec;
+  timing.maxLateUsec = m_maxLateUsec;
+  return timing;
+}
+
+void RTSPMount::wakeCapture() {
+  if (m_captureTask) {
+    xTaskNotifyGive(m_captureTask);
+  }
+}
+
+bool RTSPMount::setMulticast(const char* group, uint16_t port, uint8_t ttl) {
+  IPAddress ip;
+  if (!ip.fromString(group) || ip[0] < 224 || ip[0] > 239 || strlen(group) >= LEN_MAX_IP) {
+    return false;
+  }
+  strcpy(m_streamInfo.m_mcastIP, group);
+  m_streamInfo.m_mcastPort = port;
+  m_streamInfo.m_mcastTTL = ttl;
+  return true;
+}
+
+void RTSPMount::setAdaptiveQuality(const QualityConfig& config) {
+  m_qualityConfig = config;
+  m_adaptiveQuality = true;
+  if (m_cam) {
+    m_quality.init(m_cam, m_qualityConfig, m_usecPerFrame / 1000);
+  }
+}
+
+void RTSPMount::setSource(FrameSource* source, OV2640* cam) {
+  m_source = source;
+  m_cam = cam;
+}
+
+// server holds the settings shared by every mount
+void RTSPMount::begin(const StreamInfo* server, uint16_t port, int wakeFd) {
+  m_wakeFd = wakeFd;
+  strcpy(m_streamInfo.m_serverIP, server->m_serverIP);
+  strcpy(m_streamInfo.m_authStr, server->m_authStr);
+  m_streamInfo.m_udpMtu = server->m_udpMtu;
+  m_streamInfo.m_tcpPacketSize = server->m_tcpPacketSize;
+  m_streamInfo.m_tcpSendChunk = server->m_tcpSendChunk;
+  snprintf(m_streamInfo.m_rtspURL, LEN_MAX_URL, "rtsp://%s:%u/%s", m_streamInfo.m_serverIP, port, m_streamInfo.m_suffix);
+  m_streamInfo.m_width = m_source->getWidth();
+  m_streamInfo.m_height = m_source->getHeight();
+  m_streamInfo.m_codec = m_source->getCodec();
+  m_frameRing.init(m_source);
+  m_frameRing.setProducerWake(ringWake, this);
+  if (m_adaptiveQuality && m_cam) {
+    m_quality.init(m_cam, m_qualityConfig, m_usecPerFrame / 1000);
+  }
+  if (strlen(m_streamInfo.m_mcastIP) > 0) {
+    IPAddress group;
+    group.fromString(m_streamInfo.m_mcastIP);
+    m_mcastSocket.begin(m_streamInfo.m_mcastPort);
+    m_mcastSocket.setMulticastTTL(m_streamInfo.m_mcastTTL);
+    m_mcastSender.setUdp(&m_mcastSocket, group, m_streamInfo.m_mcastPort, m_streamInfo.m_udpMtu);
+    m_mcastSender.setRtcpUdp(&m_mcastSocket, m_streamInfo.m_mcastPort + 1);
+    RTSP_LOGI("Multicast group: %s:%d ttl %d", m_streamInfo.m_mcastIP, m_streamInfo.m_mcastPort, m_streamInfo.m_mcastTTL);
   }
+  xTaskCreatePinnedToCore(captureTask, "rtspCapture", CAPTURE_TASK_STACK_SIZE, this, CAPTURE_TASK_PRIORITY, &m_captureTask, tskNO_AFFINITY);
+  RTSP_LOGI("RTSP URL: %s", m_streamInfo.m_rtspURL);
+  RTSP_LOGI("Resolution: %dx%d", m_streamInfo.m_width, m_streamInfo.m_height);
+}
+
+EasyRTSPServer::EasyRTSPServer(uint16_t port) {
+  m_ServerPort = port;
+  memset(&m_streamInfo, 0, sizeof(m_streamInfo));
+  m_streamInfo.m_udpMtu = RTP_UDP_MTU;
+  m_streamInfo.m_tcpPacketSize = RTP_TCP_PACKET_SIZE;
+  m_streamInfo.m_tcpSendChunk = RTP_TCP_SEND_CHUNK;
+  m_mounts[0].setSuffix("mjpeg/1");
+}
+
+EasyRTSPServer::~EasyRTSPServer() {
+  delete[] m_sessionPool;
+  delete[] m_session;
+}
+
+bool EasyRTSPServer::setStreamSuffix(const char* suffix) {
+  return m_mounts[0].setSuffix(suffix);
+}
+
+void EasyRTSPServer::setFrameRate(RTSP_FRAMERATE frameRate) {
+  m_mounts[0].setFrameRate(frameRate);
+}
+
+void EasyRTSPServer::setFrameRate(float fps) {
+  m_mounts[0].setFrameRate(fps);
 }
 
 bool EasyRTSPServer::setAuthAccount(char* username, char* pwd) {
@@ -553,97 +1623,538 @@ bool EasyRTSPServer::setAuthAccount(char* username, char* pwd) {
     int l = sprintf(ori_str, "%s:%s", username, pwd);
     String str = base64::encode(reinterpret_cast<const uint8_t*>(ori_str), l);
     memcpy(m_streamInfo.m_authStr, str.c_str(), str.length());
-    Serial.printf("Auth string: %s\n", m_streamInfo.m_authStr);
+    RTSP_LOGD("Auth string: %s", m_streamInfo.m_authStr);
     return true;
   } else {
     return false;
   }
 }
 
+bool EasyRTSPServer::setMulticast(const char* group, uint16_t port, uint8_t ttl) {
+  return m_mounts[0].setMulticast(group, port, ttl);
+}
+
+// udpMtu: the path MTU towards UDP and multicast clients
+// tcpPacketSize: largest interleaved RTP packet, tcpSendChunk: bytes coalesced into one TCP write
+void EasyRTSPServer::setPacketSize(uint16_t udpMtu, uint16_t tcpPacketSize, uint32_t tcpSendChunk) {
+  m_streamInfo.m_udpMtu = max((int)udpMtu, RTP_MIN_PACKET_SIZE + 28);
+  m_streamInfo.m_tcpPacketSize = max((int)tcpPacketSize, RTP_MIN_PACKET_SIZE);
+  m_streamInfo.m_tcpSendChunk = tcpSendChunk;
+}
+
+void EasyRTSPServer::setAdaptiveQuality(const QualityConfig& config) {
+  m_mounts[0].setAdaptiveQuality(config);
+}
+
+RTSPMount* EasyRTSPServer::addStream(const char* suffix, FrameSource* source, RTSP_FRAMERATE frameRate) {
+  if (m_mountCount == MAX_MOUNTS || !source) {
+    return NULL;
+  }
+  RTSPMount* mount = &m_mounts[m_mountCount];
+  if (!mount->setSuffix(suffix)) {
+    return NULL;
+  }
+  mount->setSource(source);
+  mount->setFrameRate(frameRate);
+  m_mountCount++;
+  if (m_sessionPool) {  // server already running
+    mount->begin(&m_streamInfo, m_ServerPort, m_wakeFd);
+  }
+  return mount;
+}
+
 void EasyRTSPServer::init(OV2640* cam) {
-  m_cam = cam;
+  m_mounts[0].setSource(cam, cam);
+  init((FrameSource*)cam);
+}
+
+void EasyRTSPServer::setMaxClients(int maxClients) {
+  if (!m_sessionPool && maxClients > 0) {
+    m_maxClients = maxClients;
+  }
+}
+
+void EasyRTSPServer::init(FrameSource* source) {
+  RTSPLog::begin();
+  if (!m_mounts[0].isActive()) {
+    m_mounts[0].setSource(source);
+  }
+  if (!m_sessionPool) {
+    m_sessionPool = new RTSPSession[m_maxClients];
+    m_session = new RTSPSession*[m_maxClients]();
+    RTSP_LOGI("Session pool: %d x %u bytes", m_maxClients, (unsigned)sizeof(RTSPSession));
+  }
   IPAddress ip = WiFi.localIP();
-  sprintf(m_streamInfo.m_serverIP, "%s", ip.toString());
-  sprintf(m_streamInfo.m_rtspURL, "rtsp://%s:%u/%s", m_streamInfo.m_serverIP, m_ServerPort, m_streamInfo.m_suffix);
-  m_streamInfo.m_width = m_cam->getWidth();
-  m_streamInfo.m_height = m_cam->getHeight();
-  m_tcpServer.begin(m_ServerPort);
-  Serial.printf("RTSP URL: %s\n", m_streamInfo.m_rtspURL);
-  Serial.printf("Resolution: %dx%d\n", m_streamInfo.m_width, m_streamInfo.m_height);
-}
-
-int EasyRTSPServer::getStreamingSessionCounts() {
-  int count = 0;
-  for (int i = 0; i < MAX_CLIENTS_NUM; i++) {
-    if (m_session[i] && m_session[i]->Status() == SessionStatus::STATUS_STREAMING) {
-      count++;
+  sprintf(m_streamInfo.m_serverIP, "%s", ip.toString().c_str());
+  openWakeSocket();
+  for (int i = 0; i < m_mountCount; i++) {
+    m_mounts[i].begin(&m_streamInfo, m_ServerPort, m_wakeFd);
+  }
+  listenRtsp();
+}
+
+// The mount whose suffix is the path of the request URI. Extra path segments like
+// a /trackID=0 control suffix are allowed, the longest matching suffix wins.
+StreamInfo* EasyRTSPServer::findStream(const char* uri, size_t len) {
+  const char* end = uri + len;
+  const char* path = uri;
+  for (const char* p = uri; p + 3 <= end; p++) {
+    if (memcmp(p, "://", 3) == 0) {
+      path = (const char*)memchr(p + 3, '/', end - p - 3);  // skip the host and port
+      if (!path) {
+        return NULL;
+      }
+      break;
+    }
+  }
+  if (path < end && *path == '/') {
+    path++;
+  }
+
+  StreamInfo* found = NULL;
+  size_t foundLen = 0;
+  for (int i = 0; i < m_mountCount; i++) {
+    StreamInfo* info = m_mounts[i].getStreamInfo();
+    size_t suffixLen = strlen(info->m_suffix);
+    if (suffixLen >= foundLen && path + suffixLen <= end && strncmp(path, info->m_suffix, suffixLen) == 0
+        && (path + suffixLen == end || path[suffixLen] == '/' || path[suffixLen] == '?')) {
+      found = info;
+      foundLen = suffixLen;
     }
   }
-  return count;
+  return found;
 }
 
-void EasyRTSPServer::run() {
-  int i = 0;
-  if (m_tcpServer.hasClient()) {
-    for (i = 0; i < MAX_CLIENTS_NUM; i++) {
-      if (!rtspClient[i].connected()) {
-        rtspClient[i] = m_tcpServer.accept();
-        Serial.printf("Accept Client %s:%d\n", rtspClient[i].remoteIP().toString(), rtspClient[i].remotePort());
-        RTSPSession* session = new RTSPSession(&rtspClient[i], &m_streamInfo);
-        m_session[i] = session;
-        m_session[i]->setIndex(i);
+static int appendf(char* out, int size, int len, const char* fmt, ...) {
+  if (len >= size) {
+    return len;
+  }
+  va_list args;
+  va_start(args, fmt);
+  int n = vsnprintf(out + len, size - len, fmt, args);
+  va_end(args);
+  return n < 0 ? len : len + n;
+}
+
+static int appendHistogram(char* out, int size, int len, const char* name, const uint32_t* buckets) {
+  len = appendf(out, size, len, "%s:", name);
+  for (int i = 0; i < STATS_BUCKETS; i++) {
+    len = appendf(out, size, len, " %u", buckets[i]);
+  }
+  return appendf(out, size, len, "\r\n");
+}
+
+// One parameter per line. Histograms list their bucket counts, bucket i counts values
+// below unit << i and the last one everything above.
+int EasyRTSPServer::formatStats(StreamInfo* stream, char* out, int size) {
+  RTSPMount* mount = NULL;
+  for (int i = 0; i < m_mountCount; i++) {
+    if (m_mounts[i].getStreamInfo() == stream) {
+      mount = &m_mounts[i];
+    }
+  }
+  int len = 0;
+  if (mount) {
+    StreamStats stats = mount->getStats();
+    len = appendf(out, size, len,
+                  "stream.frames: %u\r\n"
+                  "stream.fps: %u.%02u\r\n"
+                  "stream.overruns: %u\r\n",
+                  stats.frames, stats.fps100 / 100, stats.fps100 % 100, stats.overruns);
+    len = appendHistogram(out, size, len, "stream.frame_size_4k", stats.frameSize);
+  }
+  len = appendf(out, size, len, "server.sessions_expired: %u\r\n", (unsigned)m_sessionsExpired);
+  for (int i = 0; i < m_maxClients; i++) {
+    RTSPSession* session = m_session[i];
+    if (!session || session->getStreamInfo() != stream || session->Status() < SessionStatus::STATUS_STREAMING) {
+      continue;
+    }
+    int start = len;
+    SessionStats stats = session->getStats();
+    len = appendf(out, size, len,
+                  "session.%d: %s packets=%u bytes=%u errors=%u short_writes=%u frames=%u dropped=%u\r\n",
+                  i, session->getClientIP(), stats.packets, stats.bytes, stats.sendErrors, stats.shortWrites,
+                  stats.framesSent, stats.framesDropped);
+    char name[32];
+    snprintf(name, sizeof(name), "session.%d.latency_2ms", i);
+    len = appendHistogram(out, size, len, name, stats.latency);
+    if (len >= size) {
+      len = start;  // only whole sessions
+      break;
+    }
+  }
+  return len < size ? len : 0;
+}
+
+// A loopback UDP socket connected to itself. The capture tasks send a byte per published
+// frame, which ends the select() of run() right away instead of after the next timeout.
+bool EasyRTSPServer::openWakeSocket() {
+  if (m_wakeFd >= 0) {
+    return true;
+  }
+  m_wakeFd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+  if (m_wakeFd < 0) {
+    RTSP_LOGE("could not create wake socket: %d", errno);
+    return false;
+  }
+  struct sockaddr_in addr;
+  socklen_t addrLen = sizeof(addr);
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_port = 0;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  if (bind(m_wakeFd, (struct sockaddr*)&addr, sizeof(addr)) < 0
+      || getsockname(m_wakeFd, (struct sockaddr*)&addr, &addrLen) < 0
+      || connect(m_wakeFd, (struct sockaddr*)&addr, addrLen) < 0) {
+    RTSP_LOGE("could not bind wake socket: %d", errno);
+    close(m_wakeFd);
+    m_wakeFd = -1;
+    return false;
+  }
+  fcntl(m_wakeFd, F_SETFL, fcntl(m_wakeFd, F_GETFL, 0) | O_NONBLOCK);
+  return true;
+}
+
+bool EasyRTSPServer::listenRtsp() {
+  m_listenFd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+  if (m_listenFd < 0) {
+    RTSP_LOGE("could not create rtsp socket: %d", errno);
+    return false;
+  }
+  int yes = 1;
+  setsockopt(m_listenFd, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+
+  struct sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(m_ServerPort);
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  if (bind(m_listenFd, (struct sockaddr*)&addr, sizeof(addr)) < 0 || listen(m_listenFd, m_maxClients) < 0) {
+    RTSP_LOGE("could not listen on port %d: %d", m_ServerPort, errno);
+    close(m_listenFd);
+    m_listenFd = -1;
+    return false;
+  }
+  fcntl(m_listenFd, F_SETFL, fcntl(m_listenFd, F_GETFL, 0) | O_NONBLOCK);
+  return true;
+}
+
+void EasyRTSPServer::acceptClients() {
+  int fd;
+  while ((fd = accept(m_listenFd, NULL, NULL)) >= 0) {
+    int i;
+    for (i = 0; i < m_maxClients; i++) {
+      if (!m_session[i]) {
         break;
       }
     }
-    if (i == MAX_CLIENTS_NUM) {
-      m_tcpServer.accept().stop();
+    if (i == m_maxClients) {
+      RTSP_LOGW("too many clients");
+      close(fd);
+      continue;
+    }
+    int yes = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes));  // RTSP responses must not wait behind RTP
+    m_session[i] = &m_sessionPool[i];
+    m_session[i]->open(fd, this);
+    m_session[i]->setIndex(i);
+    RTSP_LOGI("Accept Client %s", m_session[i]->getClientIP());
+  }
+}
+
+void EasyRTSPServer::run(uint32_t maxWaitMsec) {
+  int i = 0;
+  if (!m_session) {  // not initialized yet
+    return;
+  }
+
+  // Reactor: one select() over the listening socket, the RTSP connections and their RTCP
+  // sockets, plus the TCP connections whose last RTP write didn't go through completely.
+  // A session only runs when it has input, and a blocked sender only retries once writable.
+  fd_set readSet, writeSet;
+  FD_ZERO(&readSet);
+  FD_ZERO(&writeSet);
+  int maxFd = max(m_listenFd, m_wakeFd);
+  if (m_listenFd >= 0) {
+    FD_SET(m_listenFd, &readSet);
+  }
+  if (m_wakeFd >= 0) {
+    FD_SET(m_wakeFd, &readSet);
+  }
+  uint32_t waitMsec = m_wakeFd >= 0 ? maxWaitMsec : min(maxWaitMsec, (uint32_t)portTICK_PERIOD_MS);
+  for (i = 0; i < m_maxClients; i++) {
+    if (m_session[i]) {
+      int fd = m_session[i]->getSocket();
+      FD_SET(fd, &readSet);
+      if (m_session[i]->isWriteBlocked()) {
+        FD_SET(fd, &writeSet);
+      } else if (m_session[i]->hasBacklog()) {
+        waitMsec = 0;  // frames still queued behind the current batch, keep sending
+      }
+      maxFd = max(maxFd, fd);
+      int rtcpFd = m_session[i]->getRtcpSocket();
+      if (rtcpFd >= 0) {
+        FD_SET(rtcpFd, &readSet);
+        maxFd = max(maxFd, rtcpFd);
+      }
+    }
+  }
+  if (m_mcastBacklog) {
+    waitMsec = 0;
+  }
+  // sleep until a client needs us or a capture task publishes a frame
+  struct timeval tv = { (time_t)(waitMsec / 1000), (suseconds_t)(waitMsec % 1000) * 1000 };
+  if (maxFd < 0 || select(maxFd + 1, &readSet, &writeSet, NULL, &tv) < 0) {
+    FD_ZERO(&readSet);
+    FD_ZERO(&writeSet);
+  }
+
+  if (m_wakeFd >= 0 && FD_ISSET(m_wakeFd, &readSet)) {
+    char wake[16];
+    while (recv(m_wakeFd, wake, sizeof(wake), MSG_DONTWAIT) > 0) {
     }
   }
 
-  for (i = 0; i < MAX_CLIENTS_NUM; i++) {
+  if (m_listenFd >= 0 && FD_ISSET(m_listenFd, &readSet)) {
+    acceptClients();
+  }
+
+  // clients that vanished without TEARDOWN give their slot, sockets and airtime back
+  uint32_t now = millis();
+  bool reap = now - m_lastReapMsec >= RTSP_REAP_INTERVAL_MS;
+  if (reap) {
+    m_lastReapMsec = now;
+  }
+
+  for (i = 0; i < m_maxClients; i++) {
     if (m_session[i]) {
-      m_session[i]->run();
+      int rtcpFd = m_session[i]->getRtcpSocket();
+      if (FD_ISSET(m_session[i]->getSocket(), &readSet) || (rtcpFd >= 0 && FD_ISSET(rtcpFd, &readSet))) {
+        m_session[i]->run();
+      }
+    }
+    if (reap && m_session[i] && m_session[i]->Status() < SessionStatus::STATUS_CLOSED && m_session[i]->isExpired(now)) {
+      RTSP_LOGI("session %s timed out", m_session[i]->getClientIP());
+      m_sessionsExpired++;
+      m_session[i]->close();
+      m_session[i] = NULL;
     }
     if (m_session[i] && m_session[i]->Status() >= SessionStatus::STATUS_CLOSED) {
-      delete m_session[i];
+      m_session[i]->close();
       m_session[i] = NULL;
     }
   }
 
-  static uint32_t lastimage = millis();
-  uint32_t now = millis();
-  int streamingCounts = getStreamingSessionCounts();
-  if (streamingCounts > 0) {
-    if (now > lastimage + m_msecPerFrame || now < lastimage) {  // handle clock rollover
-      m_cam->run();                                             // queue up a read for next time
-      BufPtr bytes = m_cam->getfb();
-      uint32_t frameSize = m_cam->getSize();
-      lastimage = now;
-
-      // locate quant tables if possible
-      BufPtr qtable0 = NULL;
-      BufPtr qtable1 = NULL;
-
-      // if (!decodeJPEGfile(&bytes, &frameSize, &qtable0, &qtable1)) {
-      //   Serial.printf("can't decode jpeg data\n");
-      //   return;
-      // }
-      int offset = 0;
-      do {
-        offset = m_rtpPacket.packRtpPack(bytes, frameSize, offset, qtable0, qtable1, &m_streamInfo);
-        for (i = 0; i < MAX_CLIENTS_NUM; i++) {
-          if (m_session[i] && m_session[i]->Status() == SessionStatus::STATUS_STREAMING) {
-            m_session[i]->streamRTP(&m_rtpPacket, now);
-          }
+  m_mcastBacklog = false;
+  for (i = 0; i < m_mountCount; i++) {
+    if (m_mounts[i].run(m_session, m_maxClients)) {
+      m_mcastBacklog = true;
+    }
+  }
+
+  // a slow client only fills its own queue, it never holds back the others
+  for (i = 0; i < m_maxClients; i++) {
+    RTSPSession* session = m_session[i];
+    if (!session) {
+      continue;
+    }
+    bool streaming = session->Status() == SessionStatus::STATUS_STREAMING && !session->isMulticast();
+    if (session->isWriteBlocked() ? FD_ISSET(session->getSocket(), &writeSet) : streaming) {
+      session->flush();
+    }
+  }
+}
+
+// fan the newest frame of this mount out to its sessions
+bool RTSPMount::run(RTSPSession** sessions, int count) {
+  int i;
+  int streamingCounts = 0;
+  int mcastCounts = 0;
+  for (i = 0; i < count; i++) {
+    if (sessions[i] && sessions[i]->getStreamInfo() == &m_streamInfo && sessions[i]->Status() == SessionStatus::STATUS_STREAMING) {
+      streamingCounts++;
+      if (sessions[i]->isMulticast()) {
+        mcastCounts++;
+      }
+    }
+  }
+  if (mcastCounts == 0) {
+    m_mcastSender.reset();  // last subscriber left the group
+  }
+
+  bool enable = streamingCounts > 0;
+  if (enable != m_captureEnabled) {
+    m_captureEnabled = enable;
+    wakeCapture();
+  }
+  if (!enable) {
+    return false;
+  }
+
+  // only ever send the newest captured frame, the capture task keeps running meanwhile
+  FrameSlot* slot = m_frameRing.acquireLatest(m_lastFrameSeq);
+  if (slot) {
+    m_lastFrameSeq = slot->seq;
+
+    // Packetize once and queue the frame on every streaming session. Sessions only change
+    // state in EasyRTSPServer::run() and never tear a frame, so they join and drop on frame boundaries.
+    RTPFrame* rtpFrame = &m_rtpFrames[m_frameRing.indexOf(slot)];
+    bool valid;
+    if (m_streamInfo.m_codec == CODEC_H264) {
+      valid = rtpFrame->packH264(slot->frame.buf, slot->frame.len);
+      if (valid) {
+        updateParameterSets(rtpFrame);
+      }
+    } else {
+      // strip the JFIF headers, RFC 2435 carries only the scan and the quant tables
+      JpegInfo jpeg;
+      valid = decodeJPEGfile(slot->frame.buf, slot->frame.len, &jpeg);
+      if (!valid) {
+        RTSP_LOGW("can't decode jpeg data");
+      }
+      valid = valid && rtpFrame->packFrame(jpeg);
+    }
+    if (valid) {
+      for (i = 0; i < count; i++) {
+        if (sessions[i] && sessions[i]->getStreamInfo() == &m_streamInfo && sessions[i]->Status() == SessionStatus::STATUS_STREAMING && !sessions[i]->isMulticast()) {
+          sessions[i]->enqueueFrame(&m_frameRing, slot, rtpFrame);
         }
-      } while (offset != 0);
+      }
+      if (mcastCounts > 0) {
+        m_mcastSender.enqueueFrame(&m_frameRing, slot, rtpFrame);
+      }
+    }
+    m_frameRing.release(slot);
+  }
+
+  m_mcastSender.flush();
+  if (mcastCounts > 0) {
+    m_mcastSender.sendReport(millis());
+  }
+
+  // adapt quality and frame rate to what the unicast clients can take
+  uint32_t now = millis();
+  if (m_quality.isEnabled() && now - m_lastQualityMsec >= m_quality.getWindowMsec()) {
+    m_lastQualityMsec = now;
+    if (m_rateChanged.exchange(false)) {
+      m_quality.setFrameInterval(m_usecPerFrame / 1000);
+    }
+    for (i = 0; i < count; i++) {
+      if (sessions[i] && sessions[i]->getStreamInfo() == &m_streamInfo && sessions[i]->Status() == SessionStatus::STATUS_STREAMING && !sessions[i]->isMulticast()) {
+        m_quality.addSample(sessions[i]->takeQualitySample());
+      }
+    }
+    uint32_t msecPerFrame = m_quality.update();
+    if (msecPerFrame != m_usecPerFrame / 1000) {  // keep the exact interval of setFrameRate() while unchanged
+      m_usecPerFrame = msecPerFrame * 1000;
+    }
+  }
+  return m_mcastSender.getQueueDepth() > 0 && !m_mcastSender.isBlocked();
+}
+
+// Keeps the SPS/PPS of the stream for the SDP, clients that start before the next
+// IDR picture or ignore in-band parameter sets need them
+void RTSPMount::updateParameterSets(RTPFrame* frame) {
+  uint32_t spsLen, ppsLen;
+  BufPtr sps = frame->getSps(&spsLen);
+  BufPtr pps = frame->getPps(&ppsLen);
+  if (!sps || !pps || spsLen < 4 || spsLen > sizeof(m_sps) || ppsLen > sizeof(m_pps)) {
+    return;
+  }
+  if (spsLen == m_spsLen && ppsLen == m_ppsLen && memcmp(sps, m_sps, spsLen) == 0 && memcmp(pps, m_pps, ppsLen) == 0) {
+    return;
+  }
+  memcpy(m_sps, sps, spsLen);
+  m_spsLen = spsLen;
+  memcpy(m_pps, pps, ppsLen);
+  m_ppsLen = ppsLen;
+
+  String spsText = base64::encode(m_sps, m_spsLen);
+  String ppsText = base64::encode(m_pps, m_ppsLen);
+  int l = snprintf(m_streamInfo.m_h264Fmtp, sizeof(m_streamInfo.m_h264Fmtp),
+                   ";profile-level-id=%02X%02X%02X;sprop-parameter-sets=%s,%s",
+                   m_sps[1], m_sps[2], m_sps[3], spsText.c_str(), ppsText.c_str());
+  if (l >= (int)sizeof(m_streamInfo.m_h264Fmtp)) {
+    m_streamInfo.m_h264Fmtp[0] = 0;  // too large for the SDP, the clients take them in-band
+  }
+  RTSP_LOGI("%s: H.264 parameter sets %u+%u bytes", m_streamInfo.m_suffix, m_spsLen, m_ppsLen);
+}
+
+void RTSPMount::ringWake(void* arg) {
+  ((RTSPMount*)arg)->wakeCapture();
+}
+
+void RTSPMount::captureTask(void* arg) {
+  ((RTSPMount*)arg)->captureLoop();
+}
+
+// Each frame has a deadline on the microsecond clock. The task sleeps on its notification
+// until the deadline, or until run(), setFrameRate() or a session freeing a full ring wakes it,
+// and never polls.
+void RTSPMount::captureLoop() {
+  int64_t deadline = esp_timer_get_time();
+  uint32_t rateStart = millis();
+  uint32_t rateFrames = 0;
+  while (true) {
+    if (!m_captureEnabled) {
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);  // idle until the first viewer plays
+      deadline = esp_timer_get_time();
+      continue;
+    }
+    uint32_t usecPerFrame = m_usecPerFrame;
+    int64_t now = esp_timer_get_time();
+    if (usecPerFrame > 0 && now < deadline) {
+      // round up, waking before the deadline would only mean another round
+      TickType_t ticks = pdMS_TO_TICKS((deadline - now + 999) / 1000);
+      ulTaskNotifyTake(pdTRUE, ticks > 0 ? ticks : 1);
+      continue;
+    }
+    if (usecPerFrame == 0) {
+      taskYIELD();  // FRAMERATE_UNLIMITED, the source sets the pace
+      deadline = now;
+    }
 
-      m_cam->done();
+    FrameSlot* slot = m_frameRing.acquireWrite();
+    if (!slot) {
+      // every frame is still being sent, sleep until a session gives one back. Not a missed
+      // deadline, the timeout only covers a release racing with acquireWrite().
+      ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(CAPTURE_RING_WAIT_MS));
+      deadline = esp_timer_get_time();
+      continue;
+    }
 
-      now = millis();  // check if we are overrunning our max frame rate
-      if (now > lastimage + m_msecPerFrame) {
-        Serial.printf("warning exceeding max frame rate of %d ms\n", now - lastimage);
+    uint32_t late = now - deadline;
+    m_lastLateUsec = late;
+    m_avgLateUsec = m_avgLateUsec - m_avgLateUsec / 16 + late / 16;
+    if (late > m_maxLateUsec) {
+      m_maxLateUsec = late;
+    }
+    deadline += usecPerFrame;
+
+    uint32_t start = millis();
+    if (m_source->capture(&slot->frame)) {
+      m_frameSizes.add(slot->frame.len);
+      m_frameRing.publish(slot, start);
+      m_frames++;
+      rateFrames++;
+      if (start - rateStart >= 1000) {
+        m_fps100 = rateFrames * 100000 / (start - rateStart);
+        rateStart = start;
+        rateFrames = 0;
       }
+      if (m_wakeFd >= 0) {
+        send(m_wakeFd, "", 1, MSG_DONTWAIT);
+      }
+    } else {
+      m_frameRing.abort(slot);
+    }
+
+    now = esp_timer_get_time();  // check if we are overrunning our max frame rate
+    if (usecPerFrame > 0 && now - deadline > usecPerFrame) {
+      RTSP_LOGW("exceeding max frame rate, capture took %u ms", millis() - start);
+      // don't try to catch up with the missed frames
+      m_skipped += (now - deadline) / usecPerFrame;
+      deadline = now;
     }
   }
 }
\ No newline at end of file
@@ -2,23 +2,67 @@
 #define _EASYRTSPSERVER_H_
 
 #include <WiFi.h>
+#include "lwip/sockets.h"
 #include "OV2640.h"
+#include "FrameRing.h"
+#include "QualityController.h"
 #include "jpeg.h"
+#include "RTSPParser.h"
+#include "RTSPStats.h"
 
 #define LEN_MAX_SUFFIX 16
 #define LEN_MAX_IP 16
 #define LEN_MAX_URL 64
 #define LEN_MAX_AUTH 64
-#define MAX_CLIENTS_NUM 3
+// Each session takes one socket over TCP or multicast and three over UDP,
+// keep this within CONFIG_LWIP_MAX_SOCKETS
+#ifndef MAX_CLIENTS_NUM
+#define MAX_CLIENTS_NUM 8
+#endif
+
+#ifndef MAX_MOUNTS
+#define MAX_MOUNTS 4  // stream paths served at the same time
+#endif
 
 #define SERVER_RTP_PORT_BASE 57000
 
-#define RTSP_RECV_BUFFER_SIZE 384  // for incoming requests, and outgoing responses
+#define RTCP_SR_INTERVAL_MS 5000  // sender report period of every RTP stream
+#define RTCP_CNAME "EasyRTSPServer"
+
+#define CAPTURE_TASK_STACK_SIZE 8192  // face detection runs in the capture task as well
+#define CAPTURE_TASK_PRIORITY 1
+#define CAPTURE_RING_WAIT_MS 100  // longest the capture task sleeps on a full frame ring
+
+#define RTSP_RUN_WAIT_MS 100  // longest run() sleeps waiting for a socket or a new frame
+
+// Sessions without an RTSP request or an RTCP report for this long are closed,
+// advertised to the clients in the Session header
+#ifndef RTSP_SESSION_TIMEOUT_SEC
+#define RTSP_SESSION_TIMEOUT_SEC 60
+#endif
+#define RTSP_REAP_INTERVAL_MS 1000
+
+#define RTSP_RECV_BUFFER_SIZE 384  // for outgoing responses, requests go to RTSPParser
 #define RTSP_PARAM_STRING_MAX 200
+#define RTSP_STATS_BUFFER_SIZE 1280  // GET_PARAMETER stats reply, sessions that don't fit are left out
+#define RTSP_OUT_BUFFER_SIZE (RTSP_RECV_BUFFER_SIZE + RTSP_STATS_BUFFER_SIZE)  // replies waiting for the socket
 
+#define KRtpPrefixSize 4        // size of the '$' interleave prefix for RTP over RTSP
 #define KRtpHeaderSize 12       // size of the RTP header
 #define KJpegHeaderSize 8       // size of the special JPEG payload header
-#define MAX_FRAGMENT_SIZE 1300  // FIXME, pick more carefully
+#define KRestartHeaderSize 4    // restart marker header, present when the frame has a DRI
+#define KQuantHeaderSize (4 + 64 * 2)  // quant table header with two 64 byte tables
+#define KRtpMaxHeaderSize (KRtpPrefixSize + KRtpHeaderSize + KJpegHeaderSize + KRestartHeaderSize + KQuantHeaderSize)
+#define RTP_UDP_MTU 1500           // UDP packets must fit into one unfragmented IP datagram
+#define RTP_TCP_PACKET_SIZE 8192   // interleaved packets are only bound by the 16 bit length of the '$' prefix
+#define RTP_TCP_SEND_CHUNK 16384   // interleaved packets are coalesced into socket writes of up to this size
+#define RTP_MIN_PACKET_SIZE 512    // room for every header and still some payload
+#define RTP_MAX_BATCH 8            // packets per coalesced write
+#define RTP_MAX_RESTART_GROUPS 64  // restart intervals indexed per JPEG frame, the count of the others is scanned from there
+#define RTP_PAYLOAD_TYPE_H264 96   // dynamic, mapped by a=rtpmap in the SDP
+#define KFuHeaderSize 2            // FU indicator and FU header of an H.264 fragment
+#define RTP_MAX_NAL_UNITS 16       // per H.264 access unit, more slices than that aren't sent
+#define RTSP_SPROP_MAX 128         // a=fmtp parameters with base64 SPS/PPS, larger sets are left in-band only
 
 enum SessionStatus {
   STATUS_UNINIT = 0,
@@ -29,31 +73,11 @@ enum SessionStatus {
   STATUS_ERROR
 };
 
-enum RecvStatus {
-  hdrStateUnknown,
-  hdrStateGotMethod,
-  hdrStateInvalid
-};
-
-enum RecvResult {
-  RECV_BAD_REQUEST,
-  RECV_CONTINUE,
-  RECV_FULL_REQUEST
-};
-
-enum RTSP_CMD_TYPES {
-  RTSP_OPTIONS,
-  RTSP_DESCRIBE,
-  RTSP_SETUP,
-  RTSP_PLAY,
-  RTSP_TEARDOWN,
-  RTSP_UNKNOWN
-};
-
 enum RTSP_FRAMERATE{
   FRAMERATE_5HZ,
   FRAMERATE_10HZ,
   FRAMERATE_20HZ,
+  FRAMERATE_UNLIMITED,  // capture as fast as the frame source delivers
 };
 
 struct StreamInfo {
@@ -63,104 +87,425 @@ struct StreamInfo {
   char m_authStr[LEN_MAX_AUTH] = { 0 };
   int m_width;
   int m_height;
+  char m_mcastIP[LEN_MAX_IP] = { 0 };  // multicast group, empty when multicast is disabled
+  uint16_t m_mcastPort;                // RTP port of the group, RTCP is m_mcastPort + 1
+  uint8_t m_mcastTTL;
+  uint16_t m_udpMtu;
+  uint16_t m_tcpPacketSize;
+  uint32_t m_tcpSendChunk;
+  FrameCodec m_codec;
+  char m_h264Fmtp[RTSP_SPROP_MAX];  // profile-level-id and sprop-parameter-sets once the stream had an SPS
 };
 
-class RTPPacket {
+// A frame is packetized once into a header template. Every sender then cuts the
+// fragments to the packet size of its transport and renders only the headers with its
+// own seq/timestamp/SSRC, the payload is sent straight out of the camera frame.
+// JPEG frames with restart markers are cut at restart intervals, so a lost packet
+// only costs the receiver the intervals inside it and not the whole frame.
+// H.264 frames are cut at NAL unit boundaries: small leading NAL units (SPS, PPS, SEI)
+// are aggregated into one STAP-A, NAL units that fit go out as they are, larger ones as FU-A.
+class RTPFrame {
 public:
-  char *getRtpBufHead() { return m_rtpBuf; }
-  int packRtpPack(unsigned const char* jpeg, uint32_t jpegLen, int fragmentOffset, BufPtr quant0tbl, BufPtr quant1tbl, StreamInfo* streamInfo);
-  void setRtpHeader(uint32_t seq, uint32_t timestamp);
-  bool isLastFragment() { return m_isLastFragment; }
-  int getRtpPacketSize() { return m_RtpPacketSize; }
+  bool packFrame(const JpegInfo& jpeg);
+  bool packH264(BufPtr data, uint32_t len);  // one access unit of Annex-B NAL units
+  uint32_t getLength() { return m_payloadLen; }
+  // Header of the packet at *offset, the payload fills up the rest of maxPacketSize.
+  // Moves *offset past the packet, which isn't always payloadLen further for H.264.
+  int buildHeader(uint32_t* offset, int maxPacketSize, uint16_t seq, uint32_t timestamp, uint32_t ssrc, char* header, BufPtr* payload, int* payloadLen);
+  // parameter sets of the last H.264 frame packed, NULL when it had none
+  BufPtr getSps(uint32_t* len) { *len = m_spsLen; return m_sps; }
+  BufPtr getPps(uint32_t* len) { *len = m_ppsLen; return m_pps; }
+  // decodes without the frames before it: every JPEG frame, H.264 only with an IDR slice
+  bool isKeyframe() { return m_keyframe; }
 private:
-  char m_rtpBuf[1536];
-  bool m_isLastFragment;
-  int m_RtpPacketSize;
+  FrameCodec m_codec = CODEC_JPEG;
+  bool m_keyframe = true;
+  BufPtr m_jpeg = NULL;
+  uint32_t m_payloadLen = 0;  // JPEG scan, or the NAL units of the frame without start codes
+  int m_baseHeaderLen = 0;  // prefix, RTP, JPEG and restart headers shared by every fragment
+  char m_hdrTemplate[KRtpMaxHeaderSize];
+
+  // where every m_restartStride-th restart interval starts in the scan, entry k is interval
+  // k * m_restartStride. Only an index for the restart count, packets may start on any interval.
+  uint32_t m_restarts[RTP_MAX_RESTART_GROUPS];
+  int m_restartCount = 0;
+  uint32_t m_restartStride = 1;
+
+  struct NalUnit {
+    BufPtr data;     // starts with the NAL header byte
+    uint32_t len;
+    uint32_t start;  // offset of the unit among the payload of the frame
+  };
+  NalUnit m_nals[RTP_MAX_NAL_UNITS];
+  int m_nalCount = 0;
+  BufPtr m_sps = NULL;
+  uint32_t m_spsLen = 0;
+  BufPtr m_pps = NULL;
+  uint32_t m_ppsLen = 0;
+
+  void findRestarts();
+  uint32_t nextRestart(uint32_t from, uint32_t to);
+  int buildJpegHeader(uint32_t* offset, int maxPacketSize, char* header, BufPtr* payload, int* payloadLen, bool* last);
+  int buildH264Header(uint32_t* offset, int maxPacketSize, char* header, BufPtr* payload, int* payloadLen, bool* last);
+};
+
+// one packet of a batch, the header lives in RTPSender::m_batchHdr
+struct RTPPacket {
+  char* header;  // starts with the '$' prefix
+  int headerLen;
+  BufPtr payload;
+  int payloadLen;
 };
 
+// Plain UDP socket, WiFiUDP copies every packet into its own tx buffer
+// while sendmsg() takes the header and the payload as separate iovecs.
+class UDPSocket {
+public:
+  bool begin(uint16_t port);
+  void stop();
+  bool setMulticastTTL(uint8_t ttl);
+  int sendv(const struct iovec* iov, int iovcnt, IPAddress ip, uint16_t port);
+  // returns the packets that failed, bytes gets the size of the datagrams that went out
+  int sendBatch(const RTPPacket* packets, int count, IPAddress ip, uint16_t port, uint32_t* bytes);
+  int recv(uint8_t* data, int len);  // non-blocking, -1 when nothing is pending
+  int getFd() { return m_fd; }
+private:
+  int m_fd = -1;
+  bool m_gso = true;  // cleared once the kernel turns UDP_SEGMENT down
+};
+
+// RTSP connection as a bare socket, so a recycled session holds no heap of its own.
+// Replies and interleaved sender reports are queued and sent without blocking, a
+// stalled client only backs up its own queue and never holds up the network loop.
+class TCPSocket {
+public:
+  ~TCPSocket() { stop(); }
+  void attach(int fd);
+  void stop();
+  int fd() { return m_fd; }
+  size_t write(const char* data, size_t len);  // queues all of it or nothing, a full queue breaks the connection
+  char* reserve(size_t* room);  // free space at the end of the queue to format a reply in place
+  void commit(size_t len);      // queues len bytes written to reserve()
+  int flush();  // 1 once the queue is empty, 0 when the socket is full, -1 when broken
+  bool hasPending() { return m_outLen > 0; }
+  IPAddress remoteIP();
+private:
+  int m_fd = -1;
+  char m_out[RTSP_OUT_BUFFER_SIZE];
+  int m_outLen = 0;
+  bool m_overflow = false;
+};
+
+// receiver feedback of one RTP stream, taken from the client's RTCP receiver reports
+struct RTCPStats {
+  uint8_t fractionLost;     // fraction of packets lost since the previous report, in 1/256
+  int32_t cumulativeLost;   // packets lost since the stream started
+  uint32_t highestSeq;      // extended highest sequence number received
+  uint32_t jitter;          // interarrival jitter in 90kHz timestamp units
+  uint32_t rttMs;           // round trip time from LSR/DLSR, 0 until known
+  uint32_t lastReportMsec;  // millis() of the last receiver report, 0 if none yet
+};
+
+// a frame queued for sending, the sender holds a reference on its ring slot
+struct SessionFrame {
+  FrameSlot* slot;
+  RTPFrame* rtp;
+};
+
+// RTP output towards one destination: a unicast client over UDP or interleaved TCP,
+// or the multicast group that all multicast sessions share.
+class RTPSender {
+public:
+  RTPSender();
+  ~RTPSender();
+  void init();          // back to a fresh stream with a new SSRC
+  void setTcp(TCPSocket* socket, int packetSize = RTP_TCP_PACKET_SIZE, int sendChunk = RTP_TCP_SEND_CHUNK);
+  void setUdp(UDPSocket* socket, IPAddress ip, uint16_t port, int mtu = RTP_UDP_MTU);
+  void setRtcpUdp(UDPSocket* socket, uint16_t port);
+  void enqueueFrame(FrameRing* ring, FrameSlot* slot, RTPFrame* frame);
+  bool flush();         // false once the connection is broken, over TCP the queued replies go out between batches
+  void reset();         // drop everything still queued
+  void pause(uint32_t now);   // drops the queue, the RTP clock stops until resume()
+  void resume(uint32_t now);  // continues seq and timestamp from where pause() left them
+  uint16_t getNextSeq() { return m_SequenceNumber; }
+  uint32_t getRtpTime(uint32_t now);  // for RTP-Info, the timestamp a frame captured now would get
+  bool sendReport(uint32_t now);
+  void handleRtcp(const uint8_t* data, int len);
+  uint32_t getFramesSent() { return m_framesSent; }
+  uint32_t getFramesDropped() { return m_framesDropped; }
+  uint32_t getSendErrors() { return m_sendErrors; }
+  SessionStats getStats();
+  int getQueueDepth() { return (m_current.slot ? 1 : 0) + (m_pending.slot ? 1 : 0); }
+  const RTCPStats& getRtcpStats() { return m_rtcpStats; }
+  bool isBlocked() { return m_blocked; }  // the TCP socket took only part of the last write
+  bool isTcp() { return m_TcpTransport; }
+  bool isMidBatch() { return m_txOffset > 0; }  // nothing else may be written to the connection
+
+private:
+  bool m_TcpTransport = false;
+  int m_tcpFd = -1;
+  TCPSocket* m_control = NULL;  // the RTSP connection the interleaved packets share with the replies
+  UDPSocket* m_udpSocket = NULL;
+  IPAddress m_destIP;
+  uint16_t m_destPort = 0;
+  UDPSocket* m_rtcpSocket = NULL;  // RTCP over UDP, TCP uses interleaved channel 1
+  uint16_t m_rtcpPort = 0;
+
+  // Sender report counters, the rest of SessionStats below. Written by the network
+  // loop only, atomic so other tasks can read them at any time.
+  std::atomic<uint32_t> m_packetCount{ 0 };
+  std::atomic<uint32_t> m_octetCount{ 0 };
+  uint32_t m_lastReportMsec = 0;
+  RTCPStats m_rtcpStats;
+
+  uint32_t m_prevMsec = 0;
+  uint32_t m_pauseMsec = 0;
+  bool m_paused = false;  // no sender reports, the RTP clock stands still
+  uint32_t m_SequenceNumber = 0;
+  uint32_t m_Timestamp = 0;
+  uint32_t m_ssrc;
+
+  // Outbound queue: the frame being sent and the newest frame waiting behind it.
+  // A newer frame replaces the waiting one, the frame being sent is never torn.
+  // H.264 pictures refer to the ones before, so once any frame of the stream is
+  // skipped, whether by the ring, the mount or this queue, or the session joins
+  // or resumes, nothing is queued until the next IDR picture.
+  FrameRing* m_frameRing = NULL;
+  uint32_t m_nextFrameSeq = 0;  // ring seq that follows the last frame queued
+  bool m_needKeyframe = true;
+  SessionFrame m_current = { NULL, NULL };
+  SessionFrame m_pending = { NULL, NULL };
+  uint32_t m_fragmentOffset = 0;  // start of the next fragment of the current frame
+  int m_packetSize = RTP_UDP_MTU - 28;  // RTP header and payload, without the '$' prefix
+  int m_sendChunk = 0;
+
+  // Packets of the current frame on their way out, headers rendered back to back.
+  // Over TCP several packets go out in one write, over UDP in one batch of datagrams.
+  char m_batchHdr[KRtpMaxHeaderSize + (RTP_MAX_BATCH - 1) * (KRtpMaxHeaderSize - KQuantHeaderSize)];
+  RTPPacket m_batch[RTP_MAX_BATCH];
+  int m_batchCount = 0;  // 0 until the next batch has been built
+  int m_batchBytes = 0;
+  int m_txOffset = 0;    // bytes of the batch already written to the socket
+  bool m_blocked = false;
+  std::atomic<uint32_t> m_framesSent{ 0 };
+  std::atomic<uint32_t> m_framesDropped{ 0 };
+  std::atomic<uint32_t> m_sendErrors{ 0 };
+  std::atomic<uint32_t> m_bytesSent{ 0 };
+  std::atomic<uint32_t> m_shortWrites{ 0 };
+  Histogram m_latency{ STATS_LATENCY_UNIT_MS };
+
+  void buildBatch();
+  int sendBatch();
+  void nextBatch();
+  void beginFrame();
+  void releaseFrame(SessionFrame* frame);
+};
+
+class EasyRTSPServer;
+
 class RTSPSession {
 public:
-  RTSPSession(WiFiClient* client, StreamInfo* streamInfo);
+  RTSPSession();
   ~RTSPSession();
+  void open(int fd, EasyRTSPServer* server);  // sessions live in the server's pool and are reused
+  void close();
   void setIndex(int index) {
     m_index = index;
   }
   SessionStatus Status() {
     return m_status;
   }
+  bool isMulticast() {
+    return m_multicast;
+  }
+  StreamInfo* getStreamInfo() {  // the mount the session plays
+    return m_streamInfo;
+  }
+  const char* getClientIP() {
+    return m_clientIP;
+  }
+  int getSocket() { return m_tcpClient.fd(); }
+  int getRtcpSocket() { return m_rtcpSocket.getFd(); }
+  bool isWriteBlocked() { return m_rtp.isBlocked() || m_tcpClient.hasPending(); }
+  bool hasBacklog() { return m_rtp.getQueueDepth() > 0; }
+  bool isExpired(uint32_t now) { return now - m_lastActivityMsec > RTSP_SESSION_TIMEOUT_SEC * 1000UL; }
   void run();
-  void streamRTP(RTPPacket* rtpPcaket, uint32_t curMsec);
+  void enqueueFrame(FrameRing* ring, FrameSlot* slot, RTPFrame* frame);
+  void flush();
+  uint32_t getFramesSent() { return m_rtp.getFramesSent(); }
+  uint32_t getFramesDropped() { return m_rtp.getFramesDropped(); }
+  const RTCPStats& getRtcpStats() { return m_rtp.getRtcpStats(); }
+  SessionStats getStats() { return m_rtp.getStats(); }
+  QualitySample takeQualitySample();
 
 private:
-  WiFiClient* m_tcpClient;
+  TCPSocket m_tcpClient;
+  EasyRTSPServer* m_server;
   StreamInfo* m_streamInfo;
+  bool m_mountLocked = false;  // the mount can't change after SETUP
   int m_index;
   SessionStatus m_status;
-  RecvStatus m_recvStatus;
-  RTSP_CMD_TYPES m_RtspCmdType;
+  uint32_t m_lastActivityMsec;  // last request or RTCP report of the client
   unsigned m_CSeq;
   char m_clientIP[LEN_MAX_IP] = { 0 };
   IPAddress m_clientIPAddr;
-  WiFiUDP m_rtpSocket;
+  UDPSocket m_rtpSocket;
+  UDPSocket m_rtcpSocket;
 
   uint32_t m_RtspSessionID;  // create a session ID
   bool m_authed;
 
   bool m_TcpTransport;        /// if Tcp based streaming was activated
+  bool m_multicast = false;   // RTP is delivered through the shared multicast group
   uint16_t m_RtpClientPort;   // RTP receiver port on client (in host byte order!)
   uint16_t m_RtcpClientPort;  // RTCP receiver port on client (in host byte order!)
   uint16_t m_RtpServerPort;   // RTP sender port on server
   uint16_t m_RtcpServerPort;  // RTCP sender port on server
 
   char buf[RTSP_RECV_BUFFER_SIZE];
-  uint32_t m_bufPos = 0;
+  RTSPParser m_parser;
 
-  uint32_t m_prevMsec = 0;
-  uint32_t m_SequenceNumber = 0;
-  uint32_t m_Timestamp = 0;
-  uint32_t m_SendIdx = 0;
-
-  bool checkURL(char* aRequest);
-  bool parseCSeq(char* aRequest, unsigned& seq);
-  bool ParseOptionRequest(char* aRequest);
-  bool ParseDescribeRequest(char* aRequest);
-  bool ParseSetupRequest(char* aRequest);
-  bool ParsePlayRequest(char* aRequest);
-  bool ParseTeardownRequest(char* aRequest);
+  RTPSender m_rtp;
+  uint32_t m_sampleDrops = 0;  // counters at the last quality sample
+  uint32_t m_sampleErrors = 0;
+  uint32_t m_sampleReportMsec = 0;
+
+  bool checkURL(const RTSPRequest& request);
+  bool ParseDescribeRequest(const RTSPRequest& request);
+  bool ParseSetupRequest(const RTSPRequest& request);
   RecvResult recv_RTSPRequest();
-  RTSP_CMD_TYPES Handle_RtspRequest(char* aRequest, WiFiClient* client);
-  void Handle_RtspNotFound(WiFiClient* client);
-  void Handle_RtspBadRequest(WiFiClient* client);
-  void Handle_RtspTEARDOWN(WiFiClient* client);
-  void Handle_RtspPLAY(WiFiClient* client);
-  void Handle_RtspSETUP(WiFiClient* client);
-  void Handle_RtspDESCRIBE(WiFiClient* client);
-  void Handle_RtspOPTION(WiFiClient* client);
-  int SendRtpPacket(RTPPacket* rtpPcaket);
+  RTSP_CMD_TYPES Handle_RtspRequest(const RTSPRequest& request, TCPSocket* client);
+  void Handle_RtspNotFound(TCPSocket* client);
+  void Handle_RtspBadRequest(TCPSocket* client);
+  void Handle_RtspNotImplemented(TCPSocket* client);
+  void Handle_RtspUnsupportedTransport(TCPSocket* client);
+  void Handle_RtspTEARDOWN(TCPSocket* client);
+  void Handle_RtspPLAY(TCPSocket* client);
+  void Handle_RtspPAUSE(TCPSocket* client);
+  void Handle_RtspWrongState(TCPSocket* client);
+  void Handle_RtspUnauthorized(TCPSocket* client);
+  void Handle_RtspSETUP(TCPSocket* client);
+  void Handle_RtspDESCRIBE(TCPSocket* client);
+  void Handle_RtspOPTION(TCPSocket* client);
+  void Handle_RtspGET_PARAMETER(const RTSPRequest& request, TCPSocket* client);
+};
+
+// How well the capture task keeps its frame deadlines
+struct FrameTiming {
+  uint32_t frames;        // frames captured
+  uint32_t skipped;       // deadlines dropped after an overrun or with the ring full
+  uint32_t lastLateUsec;  // how late the last frame was started
+  uint32_t avgLateUsec;   // moving average over about 16 frames
+  uint32_t maxLateUsec;
+};
+
+// A mount point: one path with its own frame source, capture task and frame clock,
+// frame ring, packetization and multicast group. Sessions pick their mount by URL.
+class RTSPMount {
+public:
+  RTSPMount();
+  bool setSuffix(const char* suffix);
+  void setFrameRate(RTSP_FRAMERATE frameRate);
+  void setFrameRate(float fps);  // any rate, 0 is FRAMERATE_UNLIMITED
+  bool setMulticast(const char* group, uint16_t port, uint8_t ttl = 16);
+  void setAdaptiveQuality(const QualityConfig& config);
+  FrameTiming getFrameTiming();
+  StreamStats getStats();
+  void setSource(FrameSource* source, OV2640* cam = NULL);  // only the camera takes quality changes
+  StreamInfo* getStreamInfo() { return &m_streamInfo; }
+  FrameRing* getFrameRing() { return &m_frameRing; }
+  bool isActive() { return m_source != NULL; }
+
+  void begin(const StreamInfo* server, uint16_t port, int wakeFd);
+  bool run(RTSPSession** sessions, int count);  // true while multicast packets wait to be sent
+
+private:
+  StreamInfo m_streamInfo;
+  FrameSource* m_source = NULL;
+  OV2640* m_cam = NULL;
+  FrameRing m_frameRing;
+  RTPFrame m_rtpFrames[FRAME_RING_SIZE];  // packet list of each ring slot
+  uint8_t m_sps[64];  // H.264 parameter sets last seen in the stream
+  uint32_t m_spsLen = 0;
+  uint8_t m_pps[32];
+  uint32_t m_ppsLen = 0;
+  UDPSocket m_mcastSocket;
+  RTPSender m_mcastSender;  // every fragment goes to the group once, however many sessions joined
+  QualityController m_quality;
+  QualityConfig m_qualityConfig;
+  bool m_adaptiveQuality = false;
+  uint32_t m_lastQualityMsec = 0;
+  TaskHandle_t m_captureTask = NULL;
+  std::atomic<bool> m_captureEnabled;  // set by run() while any session of the mount is streaming
+  uint32_t m_lastFrameSeq = 0;
+  std::atomic<uint32_t> m_usecPerFrame;
+  std::atomic<bool> m_rateChanged;  // set by setFrameRate(), taken by run()
+  int m_wakeFd = -1;  // a byte sent here wakes the network loop when a frame is published
+  // written by the capture task only
+  std::atomic<uint32_t> m_frames;
+  std::atomic<uint32_t> m_skipped;
+  std::atomic<uint32_t> m_lastLateUsec;
+  std::atomic<uint32_t> m_avgLateUsec;
+  std::atomic<uint32_t> m_maxLateUsec;
+  std::atomic<uint32_t> m_fps100;
+  Histogram m_frameSizes{ STATS_FRAME_SIZE_UNIT };
+  void wakeCapture();
+  static void ringWake(void* arg);
+  static void captureTask(void* arg);
+  void captureLoop();
+  void updateParameterSets(RTPFrame* frame);
 };
 
 class EasyRTSPServer {
 public:
   EasyRTSPServer(uint16_t port = 554);
   ~EasyRTSPServer();
-  bool setStreamSuffix(char* suffix);
+  // the default stream, mounted by init()
+  bool setStreamSuffix(const char* suffix);
   void setFrameRate(RTSP_FRAMERATE frameRate);
+  void setFrameRate(float fps);
+  bool setMulticast(const char* group, uint16_t port, uint8_t ttl = 16);
+  void setAdaptiveQuality(const QualityConfig& config = QualityConfig());
+  // more streams on the same server, e.g. a cheap sub stream next to the main one.
+  // Every mount needs a source of its own, returns NULL when the table is full.
+  RTSPMount* addStream(const char* suffix, FrameSource* source, RTSP_FRAMERATE frameRate = FRAMERATE_10HZ);
+  // shared by all streams
   bool setAuthAccount(char *username, char *pwd);
+  void setPacketSize(uint16_t udpMtu, uint16_t tcpPacketSize = RTP_TCP_PACKET_SIZE, uint32_t tcpSendChunk = RTP_TCP_SEND_CHUNK);
+  void setMaxClients(int maxClients);  // before init()
   void init(OV2640* cam);
-  void run();
+  void init(FrameSource* source);
+  // Serves the clients, sleeping up to maxWaitMsec until a socket is ready or a new
+  // frame is published. 0 only polls, for sketches with more work in loop().
+  void run(uint32_t maxWaitMsec = RTSP_RUN_WAIT_MS);
+  FrameTiming getFrameTiming() { return m_mounts[0].getFrameTiming(); }
+  StreamStats getStreamStats() { return m_mounts[0].getStats(); }
+  int formatStats(StreamInfo* stream, char* out, int size);  // text/parameters for GET_PARAMETER
+  RTSPSession* getSession(int index) { return index < m_maxClients ? m_session[index] : NULL; }
+  int getMaxClients() { return m_maxClients; }
+  uint32_t getSessionsExpired() { return m_sessionsExpired; }  // closed for lack of keepalives
+  size_t getSessionPoolSize() { return m_maxClients * (sizeof(RTSPSession) + sizeof(RTSPSession*)); }
+  StreamInfo* findStream(const char* uri, size_t len);
+  StreamInfo* getStreamInfo() { return m_mounts[0].getStreamInfo(); }
 
 private:
   uint16_t m_ServerPort;
-  WiFiClient rtspClient[MAX_CLIENTS_NUM];
-  StreamInfo m_streamInfo;
-  OV2640* m_cam;
-  WiFiServer m_tcpServer;
-  RTPPacket m_rtpPacket;
-  uint32_t m_frameRate;
-  uint32_t m_msecPerFrame;
-  RTSPSession* m_session[MAX_CLIENTS_NUM] = { NULL };
-  void addSession(RTSPSession* session);
-  int getStreamingSessionCounts();
+  StreamInfo m_streamInfo;  // settings shared by the mounts
+  int m_listenFd = -1;
+  int m_wakeFd = -1;
+  bool m_mcastBacklog = false;
+  uint32_t m_lastReapMsec = 0;
+  std::atomic<uint32_t> m_sessionsExpired{ 0 };
+  RTSPMount m_mounts[MAX_MOUNTS];  // m_mounts[0] is the default stream
+  int m_mountCount = 1;
+  // All sessions are allocated once in init(), m_session[i] is &m_sessionPool[i] while in use.
+  // Reconnects then never touch the heap.
+  int m_maxClients = MAX_CLIENTS_NUM;
+  RTSPSession* m_sessionPool = NULL;
+  RTSPSession** m_session = NULL;
+  bool listenRtsp();
+  bool openWakeSocket();
+  void acceptClients();
 };
 
 #endif
\ No newline at end of file
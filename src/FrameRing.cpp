@@ -0,0 +1,131 @@
+#include "FrameRing.h"
+#include <string.h>
+
+FrameRing::FrameRing() {
+  m_source = NULL;
+  m_seq = 0;
+  m_dropped.store(0);
+  m_producerWaiting.store(false);
+  m_wakeFn = NULL;
+  m_wakeArg = NULL;
+  for (int i = 0; i < FRAME_RING_SIZE; i++) {
+    m_slots[i].state.store(SLOT_FREE);
+    m_slots[i].seq.store(0);
+    m_slots[i].msec = 0;
+    memset(&m_slots[i].frame, 0, sizeof(CamFrame));
+  }
+}
+
+void FrameRing::init(FrameSource* source) {
+  m_source = source;
+}
+
+void FrameRing::setProducerWake(WakeFn fn, void* arg) {
+  m_wakeArg = arg;
+  m_wakeFn = fn;
+}
+
+// take an unread ready slot away from the consumers and give its frame back to the source
+bool FrameRing::reclaim(FrameSlot* slot) {
+  int32_t expected = SLOT_READY;
+  if (!slot->state.compare_exchange_strong(expected, SLOT_WRITING, std::memory_order_acquire)) {
+    return false;
+  }
+  m_source->release(&slot->frame);
+  slot->seq.store(0, std::memory_order_relaxed);
+  return true;
+}
+
+FrameSlot* FrameRing::acquireWrite() {
+  for (int i = 0; i < FRAME_RING_SIZE; i++) {
+    int32_t expected = SLOT_FREE;
+    if (m_slots[i].state.compare_exchange_strong(expected, SLOT_WRITING, std::memory_order_acquire)) {
+      return &m_slots[i];
+    }
+  }
+
+  // ring full, drop the oldest frame no one is reading
+  FrameSlot* oldest = NULL;
+  uint32_t oldestSeq = 0;
+  for (int i = 0; i < FRAME_RING_SIZE; i++) {
+    uint32_t seq = m_slots[i].seq.load(std::memory_order_relaxed);
+    if (m_slots[i].state.load(std::memory_order_relaxed) == SLOT_READY && (!oldest || seq < oldestSeq)) {
+      oldest = &m_slots[i];
+      oldestSeq = seq;
+    }
+  }
+  if (oldest && reclaim(oldest)) {
+    m_dropped.fetch_add(1, std::memory_order_relaxed);
+    return oldest;
+  }
+  m_producerWaiting.store(true, std::memory_order_release);
+  return NULL;  // every slot is being read
+}
+
+void FrameRing::publish(FrameSlot* slot, uint32_t msec) {
+  uint32_t seq = ++m_seq;
+  slot->seq.store(seq, std::memory_order_relaxed);
+  slot->msec = msec;
+  slot->state.store(SLOT_READY, std::memory_order_release);  // publishes seq and the frame
+
+  for (int i = 0; i < FRAME_RING_SIZE; i++) {
+    FrameSlot* old = &m_slots[i];
+    if (old != slot && old->seq.load(std::memory_order_relaxed) < seq && old->state.load(std::memory_order_relaxed) == SLOT_READY) {
+      if (reclaim(old)) {
+        old->state.store(SLOT_FREE, std::memory_order_release);
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+  }
+}
+
+void FrameRing::abort(FrameSlot* slot) {
+  slot->seq.store(0, std::memory_order_relaxed);
+  slot->state.store(SLOT_FREE, std::memory_order_release);
+}
+
+FrameSlot* FrameRing::acquireLatest(uint32_t afterSeq) {
+  // seq only picks the candidate. A slot recycled between this scan and the increment
+  // below holds a newer frame, which is still after afterSeq.
+  FrameSlot* latest = NULL;
+  uint32_t latestSeq = afterSeq;
+  for (int i = 0; i < FRAME_RING_SIZE; i++) {
+    if (m_slots[i].state.load(std::memory_order_acquire) >= SLOT_READY) {
+      uint32_t seq = m_slots[i].seq.load(std::memory_order_relaxed);
+      if (seq > latestSeq) {
+        latest = &m_slots[i];
+        latestSeq = seq;
+      }
+    }
+  }
+  if (!latest) {
+    return NULL;
+  }
+
+  int32_t state = latest->state.load(std::memory_order_relaxed);
+  while (state >= SLOT_READY) {
+    if (latest->state.compare_exchange_weak(state, state + 1, std::memory_order_acquire)) {
+      return latest;
+    }
+  }
+  return NULL;  // reclaimed by the producer in the meantime, try again next loop
+}
+
+void FrameRing::addRef(FrameSlot* slot) {
+  slot->state.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FrameRing::release(FrameSlot* slot) {
+  // the last reader gives the frame back, a frame that has been read is never sent twice
+  int32_t expected = 1;
+  if (slot->state.compare_exchange_strong(expected, SLOT_WRITING, std::memory_order_acquire)) {
+    m_source->release(&slot->frame);
+    slot->seq.store(0, std::memory_order_relaxed);
+    slot->state.store(SLOT_FREE, std::memory_order_release);
+    if (m_producerWaiting.exchange(false, std::memory_order_acq_rel) && m_wakeFn) {
+      m_wakeFn(m_wakeArg);
+    }
+  } else {
+    slot->state.fetch_sub(1, std::memory_order_release);
+  }
+}
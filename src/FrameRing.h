@@ -0,0 +1,65 @@
+#ifndef FRAMERING_H_
+#define FRAMERING_H_
+
+#include <atomic>
+#include "FrameSource.h"
+
+// one frame being captured, the newest frame, and older frames still in
+// flight for slow sessions. Slow sessions share those, capture waits for a slot
+// when every slot is still being sent. Camera frame buffers are the real limit.
+#ifndef FRAME_RING_SIZE
+#define FRAME_RING_SIZE 5
+#endif
+
+// slot states, a value >= 0 means ready with that many readers
+#define SLOT_FREE -2
+#define SLOT_WRITING -1
+#define SLOT_READY 0
+
+// seq is written before the release store to state and read by any task, msec and
+// frame only by a reader that holds the slot, after its acquire on state
+struct FrameSlot {
+  std::atomic<int32_t> state;
+  std::atomic<uint32_t> seq;  // increasing frame number, 0 is never used
+  uint32_t msec;  // millis() when the frame was captured
+  CamFrame frame;
+};
+
+// Bounded single-producer/multi-consumer ring of encoded frames.
+// The capture task writes, the network loop only ever reads the newest frame.
+// Drop-oldest: when a frame is published, older frames nobody has started
+// reading are released right away, so a slow consumer never stalls capture.
+class FrameRing {
+public:
+  typedef void (*WakeFn)(void* arg);
+
+  FrameRing();
+  void init(FrameSource* source);
+  // called by the reader that gives a slot back while the producer waits on a full ring
+  void setProducerWake(WakeFn fn, void* arg);
+
+  // producer
+  FrameSlot* acquireWrite();
+  void publish(FrameSlot* slot, uint32_t msec);
+  void abort(FrameSlot* slot);
+
+  // consumer
+  FrameSlot* acquireLatest(uint32_t afterSeq);
+  void addRef(FrameSlot* slot);
+  void release(FrameSlot* slot);
+
+  int indexOf(FrameSlot* slot) { return slot - m_slots; }
+  uint32_t getDroppedCount() { return m_dropped.load(std::memory_order_relaxed); }
+
+private:
+  FrameSource* m_source;
+  FrameSlot m_slots[FRAME_RING_SIZE];
+  uint32_t m_seq;
+  std::atomic<uint32_t> m_dropped;
+  std::atomic<bool> m_producerWaiting;
+  WakeFn m_wakeFn;
+  void* m_wakeArg;
+  bool reclaim(FrameSlot* slot);
+};
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef FRAMESOURCE_H_
+#define FRAMESOURCE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+// How the frames of a source are encoded
+enum FrameCodec
+{
+    CODEC_JPEG,
+    CODEC_H264
+};
+
+// A captured frame that has been detached from its source
+struct CamFrame
+{
+    uint8_t *buf;
+    size_t len;
+    int width;
+    int height;
+    void *handle; // whatever the source needs to take the frame back, e.g. the driver frame buffer
+};
+
+// Where the server gets its frames from: the camera, or a recording for
+// measuring the server without a sensor. capture() is only called from the
+// capture task, release() from whichever task drops the last reference.
+// An H.264 source hands over one access unit per frame as Annex-B NAL units,
+// with SPS and PPS in front of every IDR picture.
+class FrameSource
+{
+public:
+    virtual ~FrameSource(){};
+    virtual bool capture(CamFrame *frame) = 0; // grab the next frame and hand it over to the caller
+    virtual void release(CamFrame *frame) = 0; // give a frame from capture() back
+    virtual int getWidth(void) = 0;
+    virtual int getHeight(void) = 0;
+    virtual FrameCodec getCodec(void) { return CODEC_JPEG; }
+};
+
+#endif //FRAMESOURCE_H_
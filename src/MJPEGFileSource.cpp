@@ -0,0 +1,267 @@
+#include <Arduino.h>
+#include "MJPEGFileSource.h"
+#include "jpeg.h"
+
+MJPEGFileSource::MJPEGFileSource(fs::FS &fs, const char *path, float fps, bool loop, int buffers)
+    : _fs(fs), _path(path), _loop(loop), _bufferCount(buffers)
+{
+    _usecPerFrame = fps > 0 ? (uint32_t)(1000000 / fps) : 0;
+}
+
+MJPEGFileSource::~MJPEGFileSource()
+{
+    if (_file) {
+        _file.close();
+    }
+    if (_buffers) {
+        for (int i = 0; i < _bufferCount; i++) {
+            free(_buffers[i].data);
+        }
+        delete[] _buffers;
+    }
+}
+
+bool MJPEGFileSource::begin(void)
+{
+    _file = _fs.open(_path, "r");
+    if (!_file) {
+        log_e("can't open %s", _path);
+        return false;
+    }
+
+    // one walk over the file finds the largest frame, later frames never need more
+    uint32_t start, len, largest = 0;
+    while (findFrame(&start, &len)) {
+        largest = max(largest, len);
+    }
+    if (!_buffers) {
+        _buffers = new Buffer[_bufferCount];
+        for (int i = 0; i < _bufferCount; i++) {
+            _buffers[i].data = NULL;
+            _buffers[i].size = 0;
+            _buffers[i].busy = false;
+        }
+    }
+    for (int i = 0; i < _bufferCount; i++) {
+        if (_buffers[i].size < largest) {
+            free(_buffers[i].data);
+            _buffers[i].data = (uint8_t *)(psramFound() ? ps_malloc(largest) : malloc(largest));
+            _buffers[i].size = _buffers[i].data ? largest : 0;
+        }
+    }
+    if (!rewind()) {
+        return false;
+    }
+
+    CamFrame frame;
+    if (!capture(&frame)) {
+        log_e("no jpeg frame in %s", _path);
+        return false;
+    }
+    release(&frame);
+    _frames = 0;
+    _nextFrame = 0;
+    return rewind();
+}
+
+bool MJPEGFileSource::rewind(void)
+{
+    _chunkStart = 0;
+    _chunkLen = 0;
+    _chunkPos = 0;
+    return _file.seek(0);
+}
+
+int MJPEGFileSource::readByte(void)
+{
+    if (_chunkPos == _chunkLen) {
+        _chunkStart += _chunkLen;
+        _chunkLen = _file.read(_chunk, sizeof(_chunk));
+        _chunkPos = 0;
+        if (_chunkLen == 0) {
+            return -1;
+        }
+    }
+    return _chunk[_chunkPos++];
+}
+
+bool MJPEGFileSource::skip(uint32_t n)
+{
+    if (_chunkPos + n <= _chunkLen) {
+        _chunkPos += n;
+        return true;
+    }
+    uint32_t pos = tell() + n;
+    if (pos > _file.size()) {
+        return false;
+    }
+    _chunkStart = pos;
+    _chunkLen = 0;
+    _chunkPos = 0;
+    return _file.seek(pos);
+}
+
+// entropy coded data runs up to the first marker that isn't a restart marker,
+// returns the code of that marker or -1 at the end of the file
+int MJPEGFileSource::skipScan(void)
+{
+    while (true) {
+        int c = readByte();
+        if (c < 0) {
+            return -1;
+        }
+        if (c != 0xff) {
+            continue;
+        }
+        do {
+            c = readByte();
+        } while (c == 0xff);
+        if (c < 0) {
+            return -1;
+        }
+        if (c != 0x00 && (c < 0xd0 || c > 0xd7)) {
+            return c;
+        }
+    }
+}
+
+// walk the markers of the next frame: start is its SOI and len runs through its EOI
+bool MJPEGFileSource::findFrame(uint32_t *start, uint32_t *len)
+{
+    // resync on SOI, whatever lies between two frames is skipped
+    int prev = 0, c;
+    while ((c = readByte()) >= 0) {
+        if (prev == 0xff && c == 0xd8) {
+            break;
+        }
+        prev = c;
+    }
+    if (c < 0) {
+        return false;
+    }
+    *start = tell() - 2;
+
+    int marker = -1;
+    while (true) {
+        if (marker < 0) {
+            if (readByte() != 0xff) {
+                return false;
+            }
+            do {
+                marker = readByte();
+            } while (marker == 0xff);
+            if (marker < 0) {
+                return false;
+            }
+        }
+        if (marker == 0xd9) {
+            break;
+        }
+        int code = marker;
+        marker = -1;
+        if ((code >= 0xd0 && code <= 0xd7) || code == 0x01) {
+            continue; // no length
+        }
+        int hi = readByte();
+        int lo = readByte();
+        if (lo < 0 || ((hi << 8) | lo) < 2 || !skip(((hi << 8) | lo) - 2)) {
+            return false;
+        }
+        if (code == 0xda) {
+            marker = skipScan();
+            if (marker < 0) {
+                return false;
+            }
+        }
+    }
+    *len = tell() - *start;
+    return true;
+}
+
+bool MJPEGFileSource::capture(CamFrame *frame)
+{
+    if (!_file) {
+        return false;
+    }
+    if (_usecPerFrame) {
+        uint32_t now = micros();
+        if (_frames == 0 || (int32_t)(now - _nextFrame) > 1000000) {
+            _nextFrame = now; // first frame, or we stalled: don't try to catch up
+        }
+        int32_t wait = _nextFrame - now;
+        if (wait > 0) {
+            delay(wait / 1000);
+        }
+        _nextFrame += _usecPerFrame;
+    }
+
+    uint32_t start, len;
+    if (!findFrame(&start, &len)) {
+        if (!_loop || !rewind() || !findFrame(&start, &len)) {
+            return false;
+        }
+    }
+
+    Buffer *buffer = takeBuffer(len);
+    if (!buffer) {
+        return false;
+    }
+    uint8_t *buf = buffer->data;
+    uint32_t next = tell();
+    _file.seek(start);
+    bool ok = _file.read(buf, len) == len;
+    _chunkStart = next;
+    _chunkLen = 0;
+    _chunkPos = 0;
+    _file.seek(next);
+    if (!ok) {
+        buffer->busy.store(false, std::memory_order_release);
+        return false;
+    }
+
+    JpegInfo info;
+    if (decodeJPEGfile(buf, len, &info)) {
+        _width = info.width;
+        _height = info.height;
+    }
+    frame->buf = buf;
+    frame->len = len;
+    frame->width = _width;
+    frame->height = _height;
+    frame->handle = buffer;
+    _frames++;
+    return true;
+}
+
+// a free buffer of at least len bytes, grown only for a frame larger than begin() saw
+MJPEGFileSource::Buffer *MJPEGFileSource::takeBuffer(uint32_t len)
+{
+    for (int i = 0; _buffers && i < _bufferCount; i++) {
+        bool expected = false;
+        if (!_buffers[i].busy.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+            continue;
+        }
+        Buffer *buffer = &_buffers[i];
+        if (buffer->size < len) {
+            free(buffer->data);
+            buffer->data = (uint8_t *)(psramFound() ? ps_malloc(len) : malloc(len));
+            buffer->size = buffer->data ? len : 0;
+            if (!buffer->data) {
+                log_e("no memory for a frame of %u bytes", len);
+                buffer->busy.store(false, std::memory_order_release);
+                return NULL;
+            }
+        }
+        return buffer;
+    }
+    return NULL; // every buffer is lent out
+}
+
+void MJPEGFileSource::release(CamFrame *frame)
+{
+    if (frame->handle) {
+        ((Buffer *)frame->handle)->busy.store(false, std::memory_order_release);
+    }
+    frame->handle = NULL;
+    frame->buf = NULL;
+}
@@ -0,0 +1,62 @@
+#ifndef MJPEGFILESOURCE_H_
+#define MJPEGFILESOURCE_H_
+
+#include <FS.h>
+#include <atomic>
+#include "FrameSource.h"
+#include "FrameRing.h"
+
+// Replays a recorded MJPEG file, a plain concatenation of jpeg frames as written by
+// e.g. ffmpeg -f mjpeg, so the server can be driven and measured without a sensor.
+// fps > 0 paces capture() to the recorded rate, 0 hands out frames as fast as the
+// file can be read; use FRAMERATE_UNLIMITED on the server so it doesn't pace either.
+// Frames are read into a fixed set of buffers allocated by begin(), one per frame that
+// may be lent out at a time, so replay doesn't churn the heap at the frame rate.
+class MJPEGFileSource : public FrameSource
+{
+public:
+    MJPEGFileSource(fs::FS &fs, const char *path, float fps = 0, bool loop = true, int buffers = FRAME_RING_SIZE);
+    ~MJPEGFileSource();
+    bool begin(void); // open the file, size the buffers for its largest frame
+    bool capture(CamFrame *frame) override;
+    void release(CamFrame *frame) override;
+    int getWidth(void) override { return _width; }
+    int getHeight(void) override { return _height; }
+    uint32_t getFrameCount(void) { return _frames; } // frames handed out so far
+
+private:
+    struct Buffer {
+        uint8_t *data;
+        uint32_t size;
+        std::atomic<bool> busy; // lent out by capture() until release()
+    };
+
+    bool rewind(void);
+    Buffer *takeBuffer(uint32_t len);
+    bool findFrame(uint32_t *start, uint32_t *len);
+    int skipScan(void);
+
+    // small read buffer, the markers are walked byte by byte
+    int readByte(void);
+    bool skip(uint32_t n);
+    uint32_t tell(void) { return _chunkStart + _chunkPos; }
+
+    fs::FS &_fs;
+    const char *_path;
+    fs::File _file;
+    uint32_t _usecPerFrame;
+    bool _loop;
+    int _width = 0;
+    int _height = 0;
+    uint32_t _frames = 0;
+    uint32_t _nextFrame = 0; // micros() when the next frame is due
+    Buffer *_buffers = NULL;
+    int _bufferCount;
+
+    uint8_t _chunk[512];
+    uint32_t _chunkStart = 0;
+    size_t _chunkLen = 0;
+    size_t _chunkPos = 0;
+};
+
+#endif //MJPEGFILESOURCE_H_
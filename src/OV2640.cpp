@@ -280,6 +280,7 @@ esp_err_t OV2640::run(void)
         fb = NULL;
     }
 
+    applySettings();
     fb = esp_camera_fb_get();
     if (!fb)
     {
@@ -301,7 +302,7 @@ esp_err_t OV2640::run(void)
 #endif
             if (fb->format != PIXFORMAT_JPEG)
             {
-                bool jpeg_converted = frame2jpg(fb, 20, &_jpg_buf, &_jpg_buf_len);
+                bool jpeg_converted = frame2jpg(fb, _jpg_quality, &_jpg_buf, &_jpg_buf_len);
                 _jpg_width = fb->width;
                 _jpg_height = fb->height;
                 esp_camera_fb_return(fb);
@@ -477,6 +478,88 @@ esp_err_t OV2640::run(void)
     return res;
 }
 
+bool OV2640::take(CamFrame *frame)
+{
+    if (!_jpg_buf)
+        return false;
+
+    frame->buf = _jpg_buf;
+    frame->len = _jpg_buf_len;
+    frame->width = _jpg_width;
+    frame->height = _jpg_height;
+    frame->handle = fb; // driver frame buffer to return, NULL if buf was allocated by the jpeg encoder
+
+    // the frame belongs to the caller now, the next run() must not return it
+    fb = NULL;
+    _jpg_buf = NULL;
+    return true;
+}
+
+bool OV2640::capture(CamFrame *frame)
+{
+    return run() == ESP_OK && take(frame);
+}
+
+void OV2640::release(CamFrame *frame)
+{
+    if (frame->handle) {
+        esp_camera_fb_return((camera_fb_t *)frame->handle);
+    }
+    else if (frame->buf) {
+        free(frame->buf);
+    }
+    frame->handle = NULL;
+    frame->buf = NULL;
+}
+
+void OV2640::setQuality(int quality)
+{
+    if (quality < 0)
+        quality = 0;
+    if (quality > 63)
+        quality = 63;
+    _pending_quality = quality;
+}
+
+int OV2640::getQuality(void)
+{
+    int pending = _pending_quality;
+    return pending >= 0 ? pending : (int)_quality;
+}
+
+void OV2640::setFrameSize(framesize_t frameSize)
+{
+    _pending_frame_size = frameSize;
+}
+
+// Called from run() before the next grab. Frames handed out by take() may still be in flight,
+// that is safe: the driver only refills buffers it owns again, and a frame keeps the size it
+// was taken with. A JPEG buffer is sized at init, so the frame size never grows past that one.
+void OV2640::applySettings(void)
+{
+    int quality = _pending_quality.exchange(-1);
+    if (quality >= 0) {
+        _quality = quality;
+        if (_cam_config.pixel_format == PIXFORMAT_JPEG) {
+            sensor_t *s = esp_camera_sensor_get();
+            if (s)
+                s->set_quality(s, quality);
+        }
+        else {
+            _jpg_quality = 100 - quality * 100 / 64;
+        }
+    }
+
+    int frameSize = _pending_frame_size.exchange(-1);
+    if (frameSize > _init_frame_size)
+        frameSize = _init_frame_size;
+    if (frameSize >= 0 && _cam_config.pixel_format == PIXFORMAT_JPEG) { // the other formats need fixed buffers
+        sensor_t *s = esp_camera_sensor_get();
+        if (s && s->set_framesize(s, (framesize_t)frameSize) == 0)
+            _cam_config.frame_size = (framesize_t)frameSize;
+    }
+}
+
 void OV2640::runIfNeeded(void)
 {
     if (!_jpg_buf)
@@ -529,6 +612,8 @@ esp_err_t OV2640::init(camera_config_t config)
     }
     // ESP_ERROR_CHECK(gpio_install_isr_service(0));
     ra_filter_init(&ra_filter, 20);
+    _quality = _cam_config.jpeg_quality;
+    _init_frame_size = _cam_config.frame_size;
     fb = NULL;
     _jpg_buf = NULL;
 
@@ -1,16 +1,22 @@
 #ifndef OV2640_H_
 #define OV2640_H_
 
+#include <atomic>
 #include "esp_camera.h"
+#include "FrameSource.h"
 
 #define DETECTION_SWITCH 0
 #define RECOGNITION_SWITCH 0
 
-class OV2640
+class OV2640 : public FrameSource
 {
 public:
     OV2640(){
         fb = NULL;
+        _quality = 0;
+        _pending_quality = -1;
+        _pending_frame_size = -1;
+        _init_frame_size = FRAMESIZE_INVALID;
     };
     ~OV2640(){
     };
@@ -19,15 +25,30 @@ public:
     esp_err_t run(void);
     size_t getSize(void);
     uint8_t *getfb(void);
-    int getWidth(void);
-    int getHeight(void);
+    int getWidth(void) override;
+    int getHeight(void) override;
     framesize_t getFrameSize(void);
     pixformat_t getPixelFormat(void);
+    bool take(CamFrame *frame);    // hand the current frame over to the caller
+    bool capture(CamFrame *frame) override; // run() and take()
+    void release(CamFrame *frame) override; // give a frame from take() back
+    // Runtime changes are applied by the next run(), so they are safe from any task.
+    // quality uses the jpeg_quality scale of camera_config_t: 0-63, lower is better.
+    void setQuality(int quality);
+    int getQuality(void);
+    void setFrameSize(framesize_t frameSize);
 
 private:
     void runIfNeeded(); // grab a frame if we don't already have one
 
+    void applySettings();
+
     camera_config_t _cam_config;
+    framesize_t _init_frame_size; // the driver buffers were allocated for this one
+    std::atomic<int> _quality;
+    std::atomic<int> _pending_quality;
+    std::atomic<int> _pending_frame_size;
+    uint8_t _jpg_quality = 20; // software encoder quality (1-100, higher is better) for non jpeg pixel formats
 
     camera_fb_t *fb;
     size_t _jpg_buf_len = 0;
@@ -0,0 +1,116 @@
+#include "QualityController.h"
+#include <Arduino.h>
+#include "RTSPLog.h"
+
+// Frame size steps keep the aspect ratio, so the picture never turns square or wide
+// under load. The configured maxFrameSize is always the top step.
+static const framesize_t KFrameSizeLadder[] = {
+  FRAMESIZE_QQVGA, FRAMESIZE_QVGA, FRAMESIZE_CIF, FRAMESIZE_VGA, FRAMESIZE_SVGA, FRAMESIZE_XGA, FRAMESIZE_UXGA
+};
+
+void QualityController::init(OV2640* cam, const QualityConfig& config, uint32_t msecPerFrame) {
+  m_cam = cam;
+  m_config = config;
+  m_minFromRate = m_config.minMsecPerFrame == 0;
+  if (m_config.maxFrameSize == FRAMESIZE_INVALID) {
+    m_config.maxFrameSize = cam->getFrameSize();
+  }
+  m_quality = cam->getQuality();
+  if (m_quality < m_config.bestQuality) {
+    m_quality = m_config.bestQuality;
+  }
+  m_sizeCount = 0;
+  for (size_t i = 0; i < sizeof(KFrameSizeLadder) / sizeof(KFrameSizeLadder[0]); i++) {
+    if (KFrameSizeLadder[i] >= m_config.minFrameSize && KFrameSizeLadder[i] < m_config.maxFrameSize) {
+      m_sizes[m_sizeCount++] = KFrameSizeLadder[i];
+    }
+  }
+  m_sizes[m_sizeCount++] = m_config.maxFrameSize;
+  m_sizeIndex = m_sizeCount - 1;
+  setFrameInterval(msecPerFrame);
+}
+
+void QualityController::setFrameInterval(uint32_t msecPerFrame) {
+  if (m_minFromRate) {
+    m_config.minMsecPerFrame = msecPerFrame;
+  }
+  m_msecPerFrame = msecPerFrame;
+  if (m_msecPerFrame > 0 && m_msecPerFrame < m_config.minMsecPerFrame) {
+    m_msecPerFrame = m_config.minMsecPerFrame;
+  }
+}
+
+void QualityController::addSample(const QualitySample& sample) {
+  m_sessions++;
+  if (sample.queueDepth > 1 || sample.drops > 0 || sample.sendErrors > 0 || sample.fractionLost > m_config.lossHigh) {
+    m_congested++;
+  } else if (sample.fractionLost < m_config.lossLow) {
+    m_clear++;
+  }
+}
+
+uint32_t QualityController::update() {
+  if (m_sessions > 0) {
+    // a single bad viewer doesn't degrade everyone, a congested channel does
+    if (m_congested * 100 >= m_sessions * m_config.congestedShare) {
+      m_upCount = 0;
+      if (++m_downCount >= m_config.downHold) {
+        m_downCount = 0;
+        stepDown();
+      }
+    } else if (m_clear == m_sessions) {
+      m_downCount = 0;
+      if (++m_upCount >= m_config.upHold) {
+        m_upCount = 0;
+        stepUp();
+      }
+    } else {  // in between, hold
+      m_downCount = 0;
+      m_upCount = 0;
+    }
+  }
+
+  m_sessions = 0;
+  m_congested = 0;
+  m_clear = 0;
+  return m_msecPerFrame;
+}
+
+void QualityController::stepDown() {
+  if (m_quality < m_config.worstQuality) {
+    m_quality += m_config.qualityStep;
+    if (m_quality > m_config.worstQuality) {
+      m_quality = m_config.worstQuality;
+    }
+    m_cam->setQuality(m_quality);
+    RTSP_LOGI("congested, jpeg quality %d", m_quality);
+  } else if (m_msecPerFrame > 0 && m_msecPerFrame < m_config.maxMsecPerFrame) {
+    m_msecPerFrame += max(m_msecPerFrame / 4, (uint32_t)1);
+    if (m_msecPerFrame > m_config.maxMsecPerFrame) {
+      m_msecPerFrame = m_config.maxMsecPerFrame;
+    }
+    RTSP_LOGI("congested, %d ms per frame", m_msecPerFrame);
+  } else if (m_config.adaptFrameSize && m_sizeIndex > 0) {
+    m_sizeIndex--;
+    m_cam->setFrameSize(m_sizes[m_sizeIndex]);
+    RTSP_LOGI("congested, frame size %d", m_sizes[m_sizeIndex]);
+  }
+}
+
+void QualityController::stepUp() {
+  if (m_config.adaptFrameSize && m_sizeIndex < m_sizeCount - 1) {
+    m_sizeIndex++;
+    m_cam->setFrameSize(m_sizes[m_sizeIndex]);
+  } else if (m_msecPerFrame > m_config.minMsecPerFrame) {
+    m_msecPerFrame -= m_msecPerFrame / 5;  // inverse of the 25% step down
+    if (m_msecPerFrame < m_config.minMsecPerFrame) {
+      m_msecPerFrame = m_config.minMsecPerFrame;
+    }
+  } else if (m_quality > m_config.bestQuality) {
+    m_quality -= m_config.qualityStep;
+    if (m_quality < m_config.bestQuality) {
+      m_quality = m_config.bestQuality;
+    }
+    m_cam->setQuality(m_quality);
+  }
+}
@@ -0,0 +1,63 @@
+#ifndef QUALITYCONTROLLER_H_
+#define QUALITYCONTROLLER_H_
+
+#include "OV2640.h"
+
+#define QUALITY_MAX_FRAME_SIZES 8
+
+// Limits and thresholds of the adaptive quality controller
+struct QualityConfig {
+  int bestQuality = 10;            // jpeg_quality floor, 0-63 lower is better
+  int worstQuality = 40;           // jpeg_quality ceiling
+  int qualityStep = 4;
+  uint32_t minMsecPerFrame = 0;    // fastest frame interval, 0 keeps the one of setFrameRate()
+  uint32_t maxMsecPerFrame = 500;  // slowest frame interval
+  bool adaptFrameSize = false;     // jpeg pixel format only, steps through the 4:3 sizes
+  framesize_t minFrameSize = FRAMESIZE_QVGA;
+  framesize_t maxFrameSize = FRAMESIZE_INVALID;  // FRAMESIZE_INVALID keeps the one of the camera config
+  uint8_t lossHigh = 13;           // RTCP fraction lost (1/256) above which a client is congested, ~5%
+  uint8_t lossLow = 3;             // and below which it is clear, ~1%
+  uint8_t congestedShare = 50;     // percent of streaming sessions that must be congested to step down
+  int downHold = 2;                // congested windows in a row before stepping down
+  int upHold = 5;                  // clear windows in a row before stepping up again
+  uint32_t windowMsec = 1000;
+};
+
+// Feedback of one session over the last window
+struct QualitySample {
+  int queueDepth;        // frames waiting in the send queue
+  uint32_t drops;        // frames skipped since the last window
+  uint32_t sendErrors;   // failed UDP sends since the last window
+  int fractionLost;      // last RTCP fraction lost, -1 if there is no recent report
+};
+
+// Closed loop controller: steps jpeg quality, then frame rate, then frame size down
+// while the clients are congested, and back up in the reverse order once they are clear.
+class QualityController {
+public:
+  void init(OV2640* cam, const QualityConfig& config, uint32_t msecPerFrame);
+  void setFrameInterval(uint32_t msecPerFrame);  // a new rate from setFrameRate(), 0 leaves the rate to the source
+  bool isEnabled() { return m_cam != NULL; }
+  uint32_t getWindowMsec() { return m_config.windowMsec; }
+  void addSample(const QualitySample& sample);
+  uint32_t update();  // evaluate the window, returns the frame interval to use
+
+private:
+  OV2640* m_cam = NULL;
+  QualityConfig m_config;
+  int m_quality;
+  uint32_t m_msecPerFrame;  // 0 for FRAMERATE_UNLIMITED, the rate is never stepped then
+  bool m_minFromRate = false;  // minMsecPerFrame follows setFrameRate()
+  framesize_t m_sizes[QUALITY_MAX_FRAME_SIZES];  // the sizes frame size steps go through, smallest first
+  int m_sizeCount = 0;
+  int m_sizeIndex = 0;
+  int m_sessions = 0;
+  int m_congested = 0;
+  int m_clear = 0;
+  int m_downCount = 0;
+  int m_upCount = 0;
+  void stepDown();
+  void stepUp();
+};
+
+#endif
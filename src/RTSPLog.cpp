@@ -0,0 +1,195 @@
+#include "RTSPLog.h"
+#include <Arduino.h>
+#include <string.h>
+
+// Bounded MPMC queue after Dmitry Vyukov: a cell is free for the producer at
+// position pos when seq == pos, and holds a record for the consumer when seq == pos + 1.
+struct LogCell {
+  std::atomic<uint32_t> seq;
+  LogRecord record;
+};
+
+static LogCell s_cells[RTSP_LOG_RING_SIZE];
+static TaskHandle_t s_logTask = NULL;
+
+std::atomic<uint32_t> RTSPLog::s_enqueuePos(0);
+uint32_t RTSPLog::s_dequeuePos = 0;
+std::atomic<uint32_t> RTSPLog::s_dropped(0);
+
+static struct LogCellInit {
+  LogCellInit() {
+    for (uint32_t i = 0; i < RTSP_LOG_RING_SIZE; i++) {
+      s_cells[i].seq.store(i, std::memory_order_relaxed);
+    }
+  }
+} s_logCellInit;
+
+static const char* const KLevelNames[] = { "", "E", "W", "I", "D" };
+
+void RTSPLog::begin() {
+  if (!s_logTask) {
+    xTaskCreate(logTask, "rtspLog", RTSP_LOG_TASK_STACK_SIZE, NULL, RTSP_LOG_TASK_PRIORITY, &s_logTask);
+  }
+}
+
+LogRecord* RTSPLog::reserve(uint32_t* pos) {
+  uint32_t p = s_enqueuePos.load(std::memory_order_relaxed);
+  while (true) {
+    LogCell* cell = &s_cells[p & (RTSP_LOG_RING_SIZE - 1)];
+    int32_t diff = (int32_t)(cell->seq.load(std::memory_order_acquire) - p);
+    if (diff == 0) {
+      if (s_enqueuePos.compare_exchange_weak(p, p + 1, std::memory_order_relaxed)) {
+        *pos = p;
+        cell->record.msec = millis();
+        return &cell->record;
+      }
+    } else if (diff < 0) {  // full
+      s_dropped++;
+      return NULL;
+    } else {
+      p = s_enqueuePos.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+void RTSPLog::commit(uint32_t pos) {
+  s_cells[pos & (RTSP_LOG_RING_SIZE - 1)].seq.store(pos + 1, std::memory_order_release);
+}
+
+void RTSPLog::putWord(LogRecord* record, uint32_t value) {
+  if (record->argc < RTSP_LOG_MAX_ARGS) {
+    record->args[record->argc++] = value;
+  }
+}
+
+void RTSPLog::put(LogRecord* record, double value) {
+  float f = value;
+  uint32_t bits;
+  memcpy(&bits, &f, sizeof(bits));
+  putWord(record, bits);
+}
+
+// the argument becomes the offset of the copy in record->text
+void RTSPLog::put(LogRecord* record, const char* value) {
+  uint32_t offset = record->textLen;
+  if (offset >= RTSP_LOG_TEXT_SIZE) {
+    offset = RTSP_LOG_TEXT_SIZE - 1;  // the final null, an empty string
+  } else {
+    size_t len = value ? strnlen(value, RTSP_LOG_TEXT_SIZE - 1 - offset) : 0;
+    memcpy(record->text + offset, value, len);
+    record->text[offset + len] = 0;
+    record->textLen = offset + len + 1;
+  }
+  record->text[RTSP_LOG_TEXT_SIZE - 1] = 0;
+  putWord(record, offset);
+}
+
+// printf with the arguments of the record, one conversion at a time
+static size_t formatRecord(const LogRecord& record, char* out, size_t size) {
+  size_t n = 0;
+  int arg = 0;
+  const char* p = record.fmt;
+  while (*p && n + 1 < size) {
+    if (*p != '%') {
+      out[n++] = *p++;
+      continue;
+    }
+    if (p[1] == '%') {
+      out[n++] = '%';
+      p += 2;
+      continue;
+    }
+
+    // copy flags, width and precision, drop length modifiers, every argument is 32 bits
+    char spec[16];
+    int specLen = 0;
+    int stars[2];
+    int starCount = 0;
+    spec[specLen++] = *p++;
+    while (*p && strchr("-+ #0123456789.*", *p) && specLen < (int)sizeof(spec) - 2) {
+      if (*p == '*' && starCount < 2) {
+        stars[starCount++] = arg < record.argc ? (int)record.args[arg++] : 0;
+      }
+      spec[specLen++] = *p++;
+    }
+    while (*p && strchr("hlzjt", *p)) {
+      p++;
+    }
+    char conv = *p;
+    if (!conv) {
+      break;
+    }
+    p++;
+    spec[specLen++] = conv;
+    spec[specLen] = 0;
+
+    uint32_t value = arg < record.argc ? record.args[arg++] : 0;
+    char* dst = out + n;
+    size_t room = size - n;
+    int len;
+#define FORMAT_ARG(v) (starCount == 0 ? snprintf(dst, room, spec, v) \
+                       : starCount == 1 ? snprintf(dst, room, spec, stars[0], v) \
+                       : snprintf(dst, room, spec, stars[0], stars[1], v))
+    switch (conv) {
+      case 'd':
+      case 'i':
+      case 'c':
+        len = FORMAT_ARG((int)value);
+        break;
+      case 's':
+        len = FORMAT_ARG(record.text + (value < RTSP_LOG_TEXT_SIZE ? value : RTSP_LOG_TEXT_SIZE - 1));
+        break;
+      case 'f':
+      case 'e':
+      case 'g': {
+        float f;
+        memcpy(&f, &value, sizeof(f));
+        len = FORMAT_ARG((double)f);
+        break;
+      }
+      default:
+        len = FORMAT_ARG(value);
+        break;
+    }
+#undef FORMAT_ARG
+    if (len < 0) {
+      break;
+    }
+    n += (size_t)len < room ? (size_t)len : room - 1;
+  }
+  out[n] = 0;
+  return n;
+}
+
+size_t RTSPLog::drain(char* out, size_t size) {
+  LogCell* cell = &s_cells[s_dequeuePos & (RTSP_LOG_RING_SIZE - 1)];
+  if (cell->seq.load(std::memory_order_acquire) != s_dequeuePos + 1) {
+    return 0;
+  }
+  const LogRecord& record = cell->record;
+  int n = snprintf(out, size, "[%u] %s ", (unsigned)record.msec, KLevelNames[record.level]);
+  if (n < 0 || (size_t)n >= size) {
+    n = 0;
+  }
+  n += formatRecord(record, out + n, size - n);
+  cell->seq.store(s_dequeuePos + RTSP_LOG_RING_SIZE, std::memory_order_release);
+  s_dequeuePos++;
+  return n;
+}
+
+void RTSPLog::logTask(void* arg) {
+  char line[160];
+  uint32_t reportedDrops = 0;
+  while (true) {
+    size_t n;
+    while ((n = drain(line, sizeof(line))) > 0) {
+      Serial.println(line);
+    }
+    uint32_t dropped = s_dropped;
+    if (dropped != reportedDrops) {
+      Serial.printf("log: %u records dropped\n", (unsigned)(dropped - reportedDrops));
+      reportedDrops = dropped;
+    }
+    vTaskDelay(pdMS_TO_TICKS(RTSP_LOG_DRAIN_MS));
+  }
+}
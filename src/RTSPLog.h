@@ -0,0 +1,106 @@
+#ifndef RTSPLOG_H_
+#define RTSPLOG_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+#define RTSP_LOG_NONE 0
+#define RTSP_LOG_ERROR 1
+#define RTSP_LOG_WARN 2
+#define RTSP_LOG_INFO 3
+#define RTSP_LOG_DEBUG 4
+
+// messages above this level are not even compiled in
+#ifndef RTSP_LOG_LEVEL
+#define RTSP_LOG_LEVEL RTSP_LOG_INFO
+#endif
+
+#ifndef RTSP_LOG_RING_SIZE
+#define RTSP_LOG_RING_SIZE 64  // records, a power of two
+#endif
+#define RTSP_LOG_MAX_ARGS 6
+#define RTSP_LOG_TEXT_SIZE 48  // room for copies of the string arguments of one record
+
+#define RTSP_LOG_TASK_STACK_SIZE 3072
+#define RTSP_LOG_TASK_PRIORITY 0  // idle priority, only runs when nothing else wants the core
+#define RTSP_LOG_DRAIN_MS 50
+
+// Only the format pointer and the raw arguments are stored, formatting and the slow
+// serial output happen in the drain task. The format must be a string literal.
+// Integer, float and string arguments are supported, strings are copied and cut
+// to what fits into the record.
+struct LogRecord {
+  uint32_t msec;
+  const char* fmt;
+  uint8_t level;
+  uint8_t argc;
+  uint8_t textLen;
+  uint32_t args[RTSP_LOG_MAX_ARGS];
+  char text[RTSP_LOG_TEXT_SIZE];
+};
+
+// Lock-free multi-producer ring of log records. A full ring drops the record and
+// counts it, logging never waits on the serial port or on another task.
+class RTSPLog {
+public:
+  static void begin();  // starts the drain task, records before that are kept
+  static uint32_t getDropped() { return s_dropped; }
+  static size_t drain(char* out, size_t size);  // formats one waiting record, 0 when there is none
+
+  template <typename... Args>
+  static void write(uint8_t level, const char* fmt, Args... args) {
+    uint32_t pos;
+    LogRecord* record = reserve(&pos);
+    if (!record) {
+      return;
+    }
+    record->level = level;
+    record->fmt = fmt;
+    record->argc = 0;
+    record->textLen = 0;
+    int unused[] = { 0, (put(record, args), 0)... };
+    (void)unused;
+    commit(pos);
+  }
+
+private:
+  static std::atomic<uint32_t> s_enqueuePos;
+  static uint32_t s_dequeuePos;
+  static std::atomic<uint32_t> s_dropped;
+
+  static LogRecord* reserve(uint32_t* pos);
+  static void commit(uint32_t pos);
+  // uint32_t is unsigned long on some toolchains and unsigned int on others
+  static void putWord(LogRecord* record, uint32_t value);
+  static void put(LogRecord* record, int value) { putWord(record, value); }
+  static void put(LogRecord* record, unsigned int value) { putWord(record, value); }
+  static void put(LogRecord* record, long value) { putWord(record, value); }
+  static void put(LogRecord* record, unsigned long value) { putWord(record, value); }
+  static void put(LogRecord* record, double value);
+  static void put(LogRecord* record, const char* value);
+  static void logTask(void* arg);
+};
+
+#if RTSP_LOG_LEVEL >= RTSP_LOG_ERROR
+#define RTSP_LOGE(fmt, ...) RTSPLog::write(RTSP_LOG_ERROR, fmt, ##__VA_ARGS__)
+#else
+#define RTSP_LOGE(fmt, ...) do {} while (0)
+#endif
+#if RTSP_LOG_LEVEL >= RTSP_LOG_WARN
+#define RTSP_LOGW(fmt, ...) RTSPLog::write(RTSP_LOG_WARN, fmt, ##__VA_ARGS__)
+#else
+#define RTSP_LOGW(fmt, ...) do {} while (0)
+#endif
+#if RTSP_LOG_LEVEL >= RTSP_LOG_INFO
+#define RTSP_LOGI(fmt, ...) RTSPLog::write(RTSP_LOG_INFO, fmt, ##__VA_ARGS__)
+#else
+#define RTSP_LOGI(fmt, ...) do {} while (0)
+#endif
+#if RTSP_LOG_LEVEL >= RTSP_LOG_DEBUG
+#define RTSP_LOGD(fmt, ...) RTSPLog::write(RTSP_LOG_DEBUG, fmt, ##__VA_ARGS__)
+#else
+#define RTSP_LOGD(fmt, ...) do {} while (0)
+#endif
+
+#endif
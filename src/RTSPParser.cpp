@@ -0,0 +1,234 @@
+#include "RTSPParser.h"
+#include <string.h>
+#include <strings.h>
+
+#define KInterleavedPrefixSize 4  // '$' channel len16
+
+bool RTSPSlice::equals(const char* s) const {
+  return strlen(s) == len && strncasecmp(ptr, s, len) == 0;
+}
+
+const char* RTSPSlice::find(const char* s) const {
+  size_t n = strlen(s);
+  for (const char* p = ptr; p + n <= ptr + len; p++) {
+    if (memcmp(p, s, n) == 0) {
+      return p;
+    }
+  }
+  return NULL;
+}
+
+bool RTSPSlice::contains(const char* s) const {
+  return find(s) != NULL;
+}
+
+uint32_t RTSPSlice::toUInt() const {
+  uint32_t value = 0;
+  const char* p = ptr;
+  const char* end = ptr + len;
+  while (p < end && (*p < '0' || *p > '9')) {
+    p++;
+  }
+  while (p < end && *p >= '0' && *p <= '9') {
+    value = value * 10 + (*p++ - '0');
+  }
+  return value;
+}
+
+struct MethodName {
+  const char* name;
+  RTSP_CMD_TYPES type;
+};
+
+static const MethodName KMethods[] = {
+  { "OPTIONS", RTSP_OPTIONS },
+  { "DESCRIBE", RTSP_DESCRIBE },
+  { "SETUP", RTSP_SETUP },
+  { "PLAY", RTSP_PLAY },
+  { "TEARDOWN", RTSP_TEARDOWN },
+  { "GET_PARAMETER", RTSP_GET_PARAMETER },
+  { "PAUSE", RTSP_PAUSE },
+};
+
+RTSPParser::RTSPParser() {
+  reset();
+}
+
+void RTSPParser::reset() {
+  m_head = 0;
+  m_tail = 0;
+  m_skip = 0;
+  m_consumeLen = 0;
+  startRequest();
+}
+
+void RTSPParser::startRequest() {
+  m_scanPos = m_head;
+  m_gotRequestLine = false;
+  m_gotHeader = false;
+  m_request = RTSPRequest();
+}
+
+char* RTSPParser::writeBuffer(uint32_t* space) {
+  if (m_tail == sizeof(m_buf) && m_head > 0) {
+    // Move the unparsed bytes to the front. Rare enough that a request that was
+    // half parsed simply starts over, its slices would point to the old place.
+    memmove(m_buf, m_buf + m_head, m_tail - m_head);
+    m_tail -= m_head;
+    m_head = 0;
+    startRequest();
+  }
+  *space = sizeof(m_buf) - m_tail;
+  return m_buf + m_tail;
+}
+
+void RTSPParser::commit(uint32_t len) {
+  m_tail += len;
+}
+
+RecvResult RTSPParser::next(RTSPRequest* request, uint8_t* channel, RTSPSlice* payload) {
+  if (m_consumeLen > 0) {  // drop what the previous call returned
+    m_head += m_consumeLen;
+    m_consumeLen = 0;
+    startRequest();
+  }
+  if (m_skip > 0) {
+    uint32_t n = m_tail - m_head < m_skip ? m_tail - m_head : m_skip;
+    m_head += n;
+    m_skip -= n;
+    startRequest();
+  }
+  if (m_head == m_tail) {
+    m_head = m_tail = 0;
+    startRequest();
+    return RecvResult::RECV_CONTINUE;
+  }
+
+  if (!m_gotRequestLine) {
+    // empty lines may come before a request, binary frames come between requests
+    while (m_head < m_tail && (m_buf[m_head] == '\r' || m_buf[m_head] == '\n')) {
+      m_head++;
+    }
+    m_scanPos = m_head;
+    if (m_head < m_tail && m_buf[m_head] == '$') {
+      if (m_tail - m_head < KInterleavedPrefixSize) {
+        return RecvResult::RECV_CONTINUE;
+      }
+      uint32_t len = ((uint8_t)m_buf[m_head + 2] << 8) | (uint8_t)m_buf[m_head + 3];
+      if (len + KInterleavedPrefixSize > sizeof(m_buf)) {  // can never fit, throw it away as it arrives
+        m_skip = len + KInterleavedPrefixSize;
+        return next(request, channel, payload);
+      }
+      if (m_tail - m_head < len + KInterleavedPrefixSize) {
+        return RecvResult::RECV_CONTINUE;
+      }
+      *channel = m_buf[m_head + 1];
+      payload->ptr = m_buf + m_head + KInterleavedPrefixSize;
+      payload->len = len;
+      m_consumeLen = len + KInterleavedPrefixSize;
+      return RecvResult::RECV_INTERLEAVED;
+    }
+  }
+
+  // whole lines only, a partial line is looked at again when the rest arrives
+  while (!m_gotHeader) {
+    char* line = m_buf + m_scanPos;
+    char* eol = (char*)memchr(line, '\n', m_tail - m_scanPos);
+    if (!eol) {
+      if (m_head == 0 && m_tail == sizeof(m_buf)) {
+        return RecvResult::RECV_BAD_REQUEST;  // header larger than the buffer
+      }
+      return RecvResult::RECV_CONTINUE;
+    }
+    m_scanPos = eol + 1 - m_buf;
+    uint32_t len = eol - line;
+    if (len > 0 && line[len - 1] == '\r') {
+      len--;
+    }
+    if (!m_gotRequestLine) {
+      if (!parseRequestLine(line, len)) {
+        return RecvResult::RECV_BAD_REQUEST;
+      }
+      m_gotRequestLine = true;
+    } else if (len == 0) {
+      m_gotHeader = true;
+    } else {
+      parseHeader(line, len);
+    }
+  }
+
+  uint32_t headerLen = m_scanPos - m_head;
+  if (m_request.contentLength > 0) {
+    if (headerLen + m_request.contentLength > sizeof(m_buf)) {
+      m_skip = m_request.contentLength;  // handled without its body
+    } else if (m_tail - m_scanPos < m_request.contentLength) {
+      return RecvResult::RECV_CONTINUE;
+    } else {
+      m_request.body.ptr = m_buf + m_scanPos;
+      m_request.body.len = m_request.contentLength;
+      headerLen += m_request.contentLength;
+    }
+  }
+  *request = m_request;
+  m_consumeLen = headerLen;
+  return RecvResult::RECV_FULL_REQUEST;
+}
+
+// METHOD SP URI SP RTSP/1.0
+bool RTSPParser::parseRequestLine(const char* line, uint32_t len) {
+  const char* end = line + len;
+  const char* sp1 = (const char*)memchr(line, ' ', len);
+  if (!sp1 || sp1 == line) {
+    return false;
+  }
+  const char* uri = sp1 + 1;
+  const char* sp2 = (const char*)memchr(uri, ' ', end - uri);
+  if (!sp2 || sp2 == uri || end - sp2 < 6 || strncmp(sp2 + 1, "RTSP/", 5) != 0) {
+    return false;
+  }
+  m_request.methodName.ptr = line;
+  m_request.methodName.len = sp1 - line;
+  m_request.uri.ptr = uri;
+  m_request.uri.len = sp2 - uri;
+  for (size_t i = 0; i < sizeof(KMethods) / sizeof(KMethods[0]); i++) {
+    if (m_request.methodName.len == strlen(KMethods[i].name) && strncmp(line, KMethods[i].name, m_request.methodName.len) == 0) {
+      m_request.method = KMethods[i].type;
+      break;
+    }
+  }
+  return true;
+}
+
+// Name: value, names are case insensitive
+void RTSPParser::parseHeader(const char* line, uint32_t len) {
+  const char* colon = (const char*)memchr(line, ':', len);
+  if (!colon) {
+    return;
+  }
+  RTSPSlice name;
+  name.ptr = line;
+  name.len = colon - line;
+  RTSPSlice value;
+  value.ptr = colon + 1;
+  value.len = line + len - value.ptr;
+  while (value.len > 0 && (*value.ptr == ' ' || *value.ptr == '\t')) {
+    value.ptr++;
+    value.len--;
+  }
+
+  if (name.equals("CSeq")) {
+    m_request.cseq = value;
+  } else if (name.equals("Session")) {
+    m_request.session = value;
+  } else if (name.equals("Transport")) {
+    m_request.transport = value;
+  } else if (name.equals("Accept")) {
+    m_request.accept = value;
+  } else if (name.equals("Authorization")) {
+    m_request.authorization = value;
+  } else if (name.equals("Range")) {
+    m_request.range = value;
+  } else if (name.equals("Content-Length")) {
+    m_request.contentLength = value.toUInt();
+  }
+}
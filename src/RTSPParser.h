@@ -0,0 +1,89 @@
+#ifndef RTSPPARSER_H_
+#define RTSPPARSER_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+// a whole request header, or an interleaved frame that fits, must fit in here
+#ifndef RTSP_REQUEST_BUFFER_SIZE
+#define RTSP_REQUEST_BUFFER_SIZE 512
+#endif
+
+enum RecvResult {
+  RECV_BAD_REQUEST,
+  RECV_CONTINUE,
+  RECV_FULL_REQUEST,
+  RECV_INTERLEAVED,  // a '$' framed RTP/RTCP packet from the client
+  RECV_CLOSED
+};
+
+enum RTSP_CMD_TYPES {
+  RTSP_OPTIONS,
+  RTSP_DESCRIBE,
+  RTSP_SETUP,
+  RTSP_PLAY,
+  RTSP_TEARDOWN,
+  RTSP_GET_PARAMETER,
+  RTSP_PAUSE,
+  RTSP_UNKNOWN
+};
+
+// Points into the receive buffer, not null terminated
+struct RTSPSlice {
+  const char* ptr = NULL;
+  uint16_t len = 0;
+
+  bool empty() const { return len == 0; }
+  bool equals(const char* s) const;
+  bool contains(const char* s) const;
+  const char* find(const char* s) const;
+  uint32_t toUInt() const;  // leading digits, 0 when there are none
+};
+
+struct RTSPRequest {
+  RTSP_CMD_TYPES method = RTSP_UNKNOWN;
+  RTSPSlice methodName;
+  RTSPSlice uri;
+  RTSPSlice cseq;
+  RTSPSlice session;
+  RTSPSlice transport;
+  RTSPSlice accept;
+  RTSPSlice authorization;
+  RTSPSlice range;
+  RTSPSlice body;  // empty when the body didn't fit into the buffer
+  uint32_t contentLength = 0;
+};
+
+// Single pass request parser. Every byte is looked at once: lines are split as they
+// arrive and the headers the server uses are kept as slices. Several pipelined
+// requests in one read come out one by one, '$' frames in between are passed on.
+class RTSPParser {
+public:
+  RTSPParser();
+  void reset();
+
+  // the socket reads straight into the free end of the buffer
+  char* writeBuffer(uint32_t* space);
+  void commit(uint32_t len);
+
+  // Next request or interleaved frame. The slices stay valid until the next call
+  // of next() or writeBuffer(). RECV_CONTINUE when more data is needed.
+  RecvResult next(RTSPRequest* request, uint8_t* channel, RTSPSlice* payload);
+
+private:
+  char m_buf[RTSP_REQUEST_BUFFER_SIZE];
+  uint32_t m_head;        // start of the request being parsed
+  uint32_t m_tail;        // end of the received data
+  uint32_t m_scanPos;     // start of the first line not parsed yet
+  uint32_t m_consumeLen;  // bytes of what next() returned last
+  uint32_t m_skip;        // rest of a frame or body too large for the buffer
+  bool m_gotRequestLine;
+  bool m_gotHeader;
+  RTSPRequest m_request;
+
+  void startRequest();
+  bool parseRequestLine(const char* line, uint32_t len);
+  void parseHeader(const char* line, uint32_t len);
+};
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef RTSPSTATS_H_
+#define RTSPSTATS_H_
+
+#include <stdint.h>
+#include <atomic>
+
+#define STATS_BUCKETS 8
+#define STATS_LATENCY_UNIT_MS 2     // latency buckets: < 2, 4, 8 ... 128 ms and above
+#define STATS_FRAME_SIZE_UNIT 4096  // frame size buckets: < 4, 8, 16 ... 256 KB and above
+
+// Power of two histogram, bucket i counts values below unit << i, the last bucket
+// everything else. Written by one task, read by any without locking.
+class Histogram {
+public:
+  Histogram(uint32_t unit) : m_unit(unit) { clear(); }
+  void add(uint32_t value) {
+    int i = 0;
+    while (i < STATS_BUCKETS - 1 && value >= (m_unit << i)) {
+      i++;
+    }
+    m_buckets[i].fetch_add(1, std::memory_order_relaxed);
+  }
+  void clear() {
+    for (int i = 0; i < STATS_BUCKETS; i++) {
+      m_buckets[i].store(0, std::memory_order_relaxed);
+    }
+  }
+  void get(uint32_t* buckets) const {
+    for (int i = 0; i < STATS_BUCKETS; i++) {
+      buckets[i] = m_buckets[i].load(std::memory_order_relaxed);
+    }
+  }
+
+private:
+  uint32_t m_unit;
+  std::atomic<uint32_t> m_buckets[STATS_BUCKETS];
+};
+
+// Snapshot of the counters of one session, since its SETUP
+struct SessionStats {
+  uint32_t packets;        // RTP packets sent
+  uint32_t bytes;          // bytes handed to the socket, headers included
+  uint32_t sendErrors;     // failed sends, a datagram over UDP
+  uint32_t shortWrites;    // TCP writes the socket took only in part or not at all
+  uint32_t framesSent;
+  uint32_t framesDropped;  // skipped because the client was still busy with an older frame
+  uint32_t latency[STATS_BUCKETS];  // capture to the last byte of the frame sent
+};
+
+// Snapshot of the counters of one stream, since init()
+struct StreamStats {
+  uint32_t frames;       // frames captured
+  uint32_t fps100;       // capture rate over the last second, in 1/100 fps
+  uint32_t overruns;     // frame deadlines the capture task missed
+  uint32_t frameSize[STATS_BUCKETS];
+};
+
+#endif
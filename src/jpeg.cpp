@@ -1,10 +1,14 @@
-#include <assert.h>
 #include <Arduino.h>
 #include "jpeg.h"
-
-// search for a particular JPEG marker, moves *start to just after that marker
-// This function fixes up the provided start ptr to point to the
-// actual JPEG stream data and returns the number of bytes skipped
+#include "RTSPLog.h"
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+// A camera frame looks like
+// SOI d8
 // APP0 e0
 // DQT db
 // DQT db
@@ -15,135 +19,207 @@
 // SOF0 c0 baseline (not progressive) 3 color 0x01 Y, 0x21 2h1v, 0x00 tbl0
 // - 0x02 Cb, 0x11 1h1v, 0x01 tbl1 - 0x03 Cr, 0x11 1h1v, 0x01 tbl1
 // therefore 4:2:2, with two separate quant tables (0 and 1)
+// DRI dd (optional)
 // SOS da
-// EOI d9 (no need to strip data after this RFC says client will discard)
-bool findJPEGheader(BufPtr *start, uint32_t *len, uint8_t marker) {
-    // per https://en.wikipedia.org/wiki/JPEG_File_Interchange_Format
-    unsigned const char *bytes = *start;
+// scan data
+// EOI d9 (anything after it is padding of the frame buffer)
+// RFC 2435 clients rebuild all of the headers themselves from the type, width,
+// height and quant tables, so only the scan data goes on the wire.
 
-    // kinda skanky, will break if unlucky and the headers inxlucde 0xffda
-    // might fall off array if jpeg is invalid
-    // FIXME - return false instead
-    while(bytes - *start < *len) {
-        uint8_t framing = *bytes++; // better be 0xff
-        if(framing != 0xff) {
-            Serial.printf("malformed jpeg, framing=%x\n", framing);
-            return false;
-        }
-        uint8_t typecode = *bytes++;
-        if(typecode == marker) {
-            unsigned skipped = bytes - *start;
-            //if ( debug ) printf("found marker 0x%x, skipped %d\n", marker, skipped);
+#define JPEG_MAX_QTABLES 4
 
-            *start = bytes;
+static uint16_t get16(BufPtr p) {
+    return (p[0] << 8) | p[1];
+}
 
-            // shrink len for the bytes we just skipped
-            *len -= skipped;
+// SOF0: precision, height, width, components of (id, sampling, quant table)
+static bool parseSOF(BufPtr seg, uint32_t segLen, JpegInfo *info, uint8_t *ytbl, uint8_t *ctbl) {
+    if(segLen < 6 || seg[0] != 8) {
+        RTSP_LOGW("jpeg: unsupported precision");
+        return false;
+    }
+    info->height = get16(seg + 1);
+    info->width = get16(seg + 3);
+    uint8_t components = seg[5];
+    if(components != 3 || segLen < 6 + 3 * 3) {
+        RTSP_LOGW("jpeg: %d components, need YCbCr", components);
+        return false;
+    }
+    BufPtr y = seg + 6, cb = seg + 9, cr = seg + 12;
+    if(cb[1] != 0x11 || cr[1] != 0x11 || cb[2] != cr[2]) {
+        RTSP_LOGW("jpeg: unsupported chroma sampling");
+        return false;
+    }
+    if(y[1] == 0x21) {
+        info->type = 0; // 4:2:2
+    }
+    else if(y[1] == 0x22) {
+        info->type = 1; // 4:2:0
+    }
+    else {
+        RTSP_LOGW("jpeg: unsupported luma sampling 0x%x", y[1]);
+        return false;
+    }
+    // width and height travel as multiples of 8 in a single byte
+    if(info->width == 0 || info->height == 0 || info->width > 2040 || info->height > 2040) {
+        RTSP_LOGW("jpeg: can't send %dx%d", info->width, info->height);
+        return false;
+    }
+    *ytbl = y[2];
+    *ctbl = cb[2];
+    return true;
+}
 
-            return true;
-        }
-        else {
-            // not the section we were looking for, skip the entire section
-            switch(typecode) {
-            case 0xd8:     // start of image
-            {
-                break;   // no data to skip
-            }
-            case 0xe0:   // app0
-            case 0xdb:   // dqt
-            case 0xc4:   // dht
-            case 0xc0:   // sof0
-            case 0xda:   // sos
-            {
-                // standard format section with 2 bytes for len.  skip that many bytes
-                uint32_t len = bytes[0] * 256 + bytes[1];
-                //if ( debug ) printf("skipping section 0x%x, %d bytes\n", typecode, len);
-                bytes += len;
-                break;
-            }
-            default:
-                Serial.printf("unexpected jpeg typecode 0x%x\n", typecode);
-                break;
-            }
+// DQT: one or more tables of (precision/id, 64 entries)
+static bool parseDQT(BufPtr seg, uint32_t segLen, BufPtr *qtables) {
+    while(segLen > 0) {
+        uint8_t pq = seg[0] >> 4, tq = seg[0] & 0x0f;
+        if(pq != 0 || tq >= JPEG_MAX_QTABLES || segLen < 1 + 64) {
+            RTSP_LOGW("jpeg: unsupported quant table 0x%x", seg[0]);
+            return false;
         }
+        qtables[tq] = seg + 1;
+        seg += 1 + 64;
+        segLen -= 1 + 64;
     }
+    return true;
+}
 
-    Serial.printf("failed to find jpeg marker 0x%x", marker);
-    return false;
+// Entropy coded data is mostly free of 0xff, so skip it a word at a time: a word
+// holds a 0xff byte exactly when its complement holds a zero byte.
+uint32_t findFF(BufPtr p, uint32_t i, uint32_t len) {
+#if defined(__SSE2__)
+    const __m128i ff = _mm_set1_epi8((char)0xff);
+    while(i + 16 <= len) {
+        int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(p + i)), ff));
+        if(mask)
+            return i + __builtin_ctz(mask);
+        i += 16;
+    }
+#elif defined(__ARM_NEON)
+    while(i + 16 <= len) {
+        uint8x16_t eq = vceqq_u8(vld1q_u8(p + i), vdupq_n_u8(0xff));
+        // narrow to 4 bits per byte so the whole compare fits in 64 bits
+        uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+        if(mask)
+            return i + (__builtin_ctzll(mask) >> 2);
+        i += 16;
+    }
+#endif
+    // Xtensa has no unaligned loads, get to a word boundary first
+    while(i < len && ((uintptr_t)(p + i) & 3)) {
+        if(p[i] == 0xff)
+            return i;
+        i++;
+    }
+    while(i + 4 <= len) {
+        uint32_t w;
+        memcpy(&w, __builtin_assume_aligned(p + i, 4), 4);
+        w = ~w;
+        if((w - 0x01010101u) & ~w & 0x80808080u)
+            break; // one of these four
+        i += 4;
+    }
+    while(i < len && p[i] != 0xff)
+        i++;
+    return i;
 }
 
 // the scan data uses byte stuffing to guarantee anything that starts with 0xff
-// followed by something not zero, is a new section.  Look for that marker and return the ptr
-// pointing there
-void skipScanBytes(BufPtr *start) {
-    BufPtr bytes = *start;
-
-    while(true) { // FIXME, check against length
-        while(*bytes++ != 0xff);
-        if(*bytes++ != 0) {
-            *start = bytes - 2; // back up to the 0xff marker we just found
-            return;
+// followed by something not zero, is a new section. Restart markers belong to the
+// scan, the first other marker ends it. returns the offset of that marker or len
+static uint32_t skipScanBytes(BufPtr scan, uint32_t len) {
+    uint32_t i = 0;
+    while(true) {
+        i = findFF(scan, i, len);
+        if(i + 1 >= len)
+            return len;
+        uint8_t next = scan[i + 1];
+        if(next != 0x00 && (next < 0xd0 || next > 0xd7) && next != 0xff) {
+            return i;
         }
+        i += next == 0xff ? 1 : 2; // 0xff fill bytes may precede a marker
     }
 }
-void  nextJpegBlock(BufPtr *bytes) {
-    uint32_t len = (*bytes)[0] * 256 + (*bytes)[1];
-    //if ( debug ) printf("going to next jpeg block %d bytes\n", len);
-    *bytes += len;
-}
 
-// When JPEG is stored as a file it is wrapped in a container
-// This function fixes up the provided start ptr to point to the
-// actual JPEG stream data and returns the number of bytes skipped
-bool decodeJPEGfile(BufPtr *start, uint32_t *len, BufPtr *qtable0, BufPtr *qtable1) {
+bool decodeJPEGfile(BufPtr start, uint32_t len, JpegInfo *info) {
     // per https://en.wikipedia.org/wiki/JPEG_File_Interchange_Format
-    unsigned const char *bytes = *start;
-
-    if(!findJPEGheader(&bytes, len, 0xd8)) // better at least look like a jpeg file
-        return false; // FAILED!
-
-    // Look for quant tables if they are present
-    *qtable0 = NULL;
-    *qtable1 = NULL;
-    BufPtr quantstart = *start;
-    uint32_t quantlen = *len;
-    if(!findJPEGheader(&quantstart, &quantlen, 0xdb)) {
-        Serial.printf("error can't find quant table 0\n");
+    BufPtr qtables[JPEG_MAX_QTABLES] = { NULL };
+    uint8_t ytbl = 0, ctbl = 0;
+    bool gotSOF = false;
+
+    memset(info, 0, sizeof(*info));
+    if(len < 4 || start[0] != 0xff || start[1] != 0xd8) { // better at least look like a jpeg file
+        RTSP_LOGW("jpeg: missing SOI");
+        return false;
     }
-    else {
-        // if ( debug ) printf("found quant table %x\n", quantstart[2]);
 
-        *qtable0 = quantstart + 3;     // 3 bytes of header skipped
-        nextJpegBlock(&quantstart);
-        if(!findJPEGheader(&quantstart, &quantlen, 0xdb)) {
-            Serial.printf("error can't find quant table 1\n");
+    uint32_t pos = 2;
+    while(pos + 4 <= len) {
+        if(start[pos] != 0xff) {
+            RTSP_LOGW("malformed jpeg, framing=%x", start[pos]);
+            return false;
+        }
+        uint8_t typecode = start[pos + 1];
+        if(typecode == 0xff) { // fill byte
+            pos++;
+            continue;
         }
-        else {
-            // if ( debug ) printf("found quant table %x\n", quantstart[2]);
+        // every marker up to SOS is a standard section with 2 bytes for len, the len included
+        uint32_t segLen = get16(start + pos + 2);
+        if(segLen < 2 || pos + 2 + segLen > len) {
+            RTSP_LOGW("jpeg: section 0x%x overruns the frame", typecode);
+            return false;
         }
-        *qtable1 = quantstart + 3;
-        nextJpegBlock(&quantstart);
+        BufPtr seg = start + pos + 4;
+        segLen -= 2;
+
+        switch(typecode) {
+        case 0xc0: // sof0
+            if(!parseSOF(seg, segLen, info, &ytbl, &ctbl))
+                return false;
+            gotSOF = true;
+            break;
+        case 0xc1: case 0xc2: case 0xc3: case 0xc5: case 0xc6: case 0xc7:
+        case 0xc9: case 0xca: case 0xcb: case 0xcd: case 0xce: case 0xcf:
+            RTSP_LOGW("jpeg: only baseline is supported, got SOF 0x%x", typecode);
+            return false;
+        case 0xdb: // dqt
+            if(!parseDQT(seg, segLen, qtables))
+                return false;
+            break;
+        case 0xdd: // dri
+            if(segLen < 2)
+                return false;
+            info->restartInterval = get16(seg);
+            break;
+        case 0xda: { // sos
+            if(!gotSOF) {
+                RTSP_LOGW("jpeg: SOS before SOF");
+                return false;
+            }
+            info->qtable0 = qtables[ytbl];
+            info->qtable1 = qtables[ctbl];
+            if(!info->qtable0 || !info->qtable1) {
+                RTSP_LOGW("jpeg: missing quant table");
+                return false;
+            }
+            info->scan = seg + segLen;
+            uint32_t remain = len - (info->scan - start);
+            uint32_t end = skipScanBytes(info->scan, remain);
+            if(end + 1 >= remain || info->scan[end + 1] != 0xd9) {
+                RTSP_LOGW("jpeg: scan not terminated by EOI");
+                return false;
+            }
+            info->scanLen = end;
+            return true;
+        }
+        default: // APPn, COM, DHT - nothing the RTP receiver needs
+            break;
+        }
+        pos += 2 + 2 + segLen;
     }
 
-    if(!findJPEGheader(start, len, 0xda))
-        return false; // FAILED!
-
-    // Skip the header bytes of the SOS marker FIXME why doesn't this work?
-    uint32_t soslen = (*start)[0] * 256 + (*start)[1];
-    *start += soslen;
-    *len -= soslen;
-
-    // start scanning the data portion of the scan to find the end marker
-    BufPtr endmarkerptr = *start;
-    uint32_t endlen = *len;
-
-    skipScanBytes(&endmarkerptr);
-    if(!findJPEGheader(&endmarkerptr, &endlen, 0xd9))
-        return false; // FAILED!
-
-    // endlen must now be the # of bytes between the start of our scan and
-    // the end marker, tell the caller to ignore bytes afterwards
-    *len = endmarkerptr - *start;
-
-    return true;
+    RTSP_LOGW("jpeg: no scan found");
+    return false;
 }
\ No newline at end of file
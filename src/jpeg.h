@@ -1,18 +1,30 @@
 #ifndef JPEG_H_
 #define JPEG_H_
 
+#include <stdint.h>
+
 typedef unsigned const char* BufPtr;
 
-// When JPEG is stored as a file it is wrapped in a container
-// This function fixes up the provided start ptr to point to the
-// actual JPEG stream data and returns the number of bytes skipped
-// returns true if the file seems to be valid jpeg
-// If quant tables can be found they will be stored in qtable0/1
-bool decodeJPEGfile(BufPtr *start, uint32_t *len, BufPtr *qtable0, BufPtr *qtable1);
-bool findJPEGheader(BufPtr *start, uint32_t *len, uint8_t marker);
+// What RFC 2435 needs to know about a baseline JFIF frame
+struct JpegInfo {
+    BufPtr scan;              // entropy coded data, the only part sent as RTP payload
+    uint32_t scanLen;         // up to, not including, the EOI marker
+    BufPtr qtable0;           // 64 byte luma quant table
+    BufPtr qtable1;           // 64 byte chroma quant table
+    uint8_t type;             // RFC 2435 type, 0 for 4:2:2 and 1 for 4:2:0
+    uint16_t width;
+    uint16_t height;
+    uint16_t restartInterval; // MCUs between restart markers, 0 without DRI
+};
+
+// When JPEG is stored as a file it is wrapped in a container.
+// Walks the markers of the len bytes at start without ever reading past them,
+// validates that the frame can be carried by RFC 2435 and fills in info.
+// returns false if the frame is malformed, truncated or unsupported
+bool decodeJPEGfile(BufPtr start, uint32_t len, JpegInfo *info);
 
-// Given a jpeg ptr pointing to a pair of length bytes, advance the pointer to
-// the next 0xff marker byte
-void nextJpegBlock(BufPtr *start);
+// returns the offset of the first 0xff at or after i of the len bytes at p, or len.
+// What decodeJPEGfile() walks the scan with, exposed for the benchmarks.
+uint32_t findFF(BufPtr p, uint32_t i, uint32_t len);
 
 #endif
\ No newline at end of file